@@ -81,6 +81,12 @@ import builder.widgets.Widget;
  * <li>arduino.t for arduino code templates
  * <li>arduino_min.t for arduino flash code templates
  * <li>linux.t for linux code templates
+ * </ul>
+ * <p>
+ * For linux the static widgets (boxes, text and text buttons) can optionally
+ * be emitted as const page tables that are added with gslc_PageAddConst()
+ * so that they require no element construction at startup.
+ * </p>
  * 
  * Kind of a Quick and Dirty implementation.
  * 
@@ -646,6 +652,9 @@ public class CodeGenerator {
    */
   private int screenHeight = 240;
   
+  /** Generate const page tables */
+  private boolean bConstPages = false;
+  
   /**
    * Gets the single instance of CodeGenerator.
    *
@@ -723,6 +732,7 @@ public class CodeGenerator {
         targetPlatform = ARDUINO_PLATFORM;
         break;
     }
+    bConstPages = (targetPlatform == LINUX_PLATFORM) && generalModel.isConstPages();
     if (fileName == null) {
       return null;
     }
@@ -802,6 +812,7 @@ public class CodeGenerator {
         targetPlatform = ARDUINO_PLATFORM;
         break;
     }
+    bConstPages = false;
     String fileName = new String(outName + fileExtension);
     // prompt the user to enter output name
     projectFile = new File(fileName);
@@ -1243,13 +1254,19 @@ public class CodeGenerator {
     } else {
       templateLines = loadTemplate(DEFINE_PG_MAX_TEMPLATE);
       for (PagePane p : pages) {
-        int count = 0;
-        for (Widget w : p.getWidgets()) {
-          if (w.getType().equals(EnumFactory.TEXTBOX)) {
-            count += 3;  // TEXTBOX has embedded a wrapper Box and a scrollbar along with text box
-          } else {
-            count++;
-          }
+        int count = countPageElems(p);
+        int const_cnt = 0;
+        if (bConstPages) {
+          const_cnt = getConstWidgets(p).size();
+        }
+        if (const_cnt > 0) {
+          // elements of the const page table need an element reference but no RAM element
+          String strEnum = convertEnum(p.getEnum());
+          pw.printf("#define MAX_ELEM_%s %d%n", strEnum, count);
+          pw.printf("#define MAX_ELEM_%s_CONST %d%n", strEnum, const_cnt);
+          pw.printf("#define MAX_ELEM_%s_RAM MAX_ELEM_%s - MAX_ELEM_%s_CONST%n", 
+              strEnum, strEnum, strEnum);
+          continue;
         }
         macro[0] = STRIP_ENUM_MACRO;
         replacement[0] = convertEnum(p.getEnum());
@@ -1276,11 +1293,27 @@ public class CodeGenerator {
     List<String> templateLines = loadTemplate(GUI_ELEMENT_TEMPLATE);
     List<String> outputLines = null;
     int i=0;
+    if (bConstPages) {
+      // const page tables reference the button callback before it is defined
+      List<String> widgetTypes = new ArrayList<String>();
+      widgetTypes.add(EnumFactory.TEXTBUTTON);
+      for (PagePane p : pages) {
+        if (countByType(p.getWidgets(), widgetTypes) > 0) {
+          pw.printf("bool CbBtnCommon(void* pvGui,void *pvElemRef,gslc_teTouch eTouch,int16_t nX,int16_t nY);%n");
+          break;
+        }
+      }
+    }
     for (PagePane p : pages) {
+      i++;
+      if (bConstPages && getConstWidgets(p).size() > 0) {
+        outputPageConst(p, i);
+        continue;
+      }
       macro[0] = STRIP_ENUM_MACRO;
       replacement[0] = convertEnum(p.getEnum());
       macro[1] = COUNT_MACRO;
-      replacement[1] = String.valueOf(++i);
+      replacement[1] = String.valueOf(i);
       macro[2] = null;
       outputLines = expandMacros(templateLines, macro, replacement);
       writeTemplate(outputLines);
@@ -1643,12 +1676,27 @@ public class CodeGenerator {
     List<String> outputLines = null;
     int i=0;
     for (PagePane p : pages) {
+      i++;
+      int const_cnt = 0;
+      if (bConstPages) {
+        const_cnt = getConstWidgets(p).size();
+      }
+      if (const_cnt > 0) {
+        String strEnum = convertEnum(p.getEnum());
+        String strElem = "NULL,0";
+        if (countPageElems(p) > const_cnt) {
+          strElem = "m_asPage" + i + "Elem,MAX_ELEM_" + strEnum + "_RAM";
+        }
+        pw.printf("  gslc_PageAddConst(&m_gui,%s,&m_sPage%dConst,%s,m_asPage%dElemRef,MAX_ELEM_%s);%n",
+            p.getEnum(), i, strElem, i, strEnum);
+        continue;
+      }
       macro[0] = PAGE_ENUM_MACRO;
       replacement[0] = p.getEnum();
       macro[1] = STRIP_ENUM_MACRO;
       replacement[1] = convertEnum(p.getEnum());
       macro[2] = COUNT_MACRO;
-      replacement[2] = String.valueOf(++i);
+      replacement[2] = String.valueOf(i);
       macro[3] = null;
       outputLines = expandMacros(templateLines, macro, replacement);
       writeTemplate(outputLines);
@@ -1665,6 +1713,10 @@ public class CodeGenerator {
       pw.printf("%n  // -----------------------------------%n");
       pw.printf("  // PAGE: %s%n", p.getEnum());
       for (Widget w : p.getWidgets()) {
+        // widgets in a const page table need no construction
+        if (bConstPages && isConstWidget(w.getModel())) {
+          continue;
+        }
         outputAPI(p.getEnum(), w.getModel());
       }
     }
@@ -3033,6 +3085,136 @@ private void outputAPI(String pageEnum, WidgetModel m) {
     }
   }
 
+  /**
+   * Output const page table.
+   * The static widgets of the page are emitted as const element and element
+   * reference arrays along with an ID index (sorted in the same order as the
+   * element enums) and hit-test buckets for the touch-enabled elements.
+   * Storage is also allocated for the remaining widgets of the page,
+   * which are created at runtime on top of the const elements.
+   *
+   * @param p
+   *          the page
+   * @param nPage
+   *          the page count
+   */
+  private void outputPageConst(PagePane p, int nPage) {
+    final List<WidgetModel> mList = getConstWidgets(p);
+    String strEnum = convertEnum(p.getEnum());
+    String strElem = "m_asPage" + nPage + "ElemConst";
+    int nCnt = mList.size();
+    int i;
+    pw.printf("%n// Const page table for %s%n", p.getEnum());
+    pw.printf("%-32s%s[%d] = {%n", "static const gslc_tsElem", strElem, nCnt);
+    for (WidgetModel m : mList) {
+      pw.printf("  %s,%n", constElemInit(m));
+    }
+    pw.printf("};%n");
+    pw.printf("%-32sm_asPage%dElemRefConst[%d] = {%n", "static const gslc_tsElemRef", nPage, nCnt);
+    for (i=0; i<nCnt; i++) {
+      pw.printf("  GSLC_ELEMREF_CONST(%s,%d),%n", strElem, i);
+    }
+    pw.printf("};%n");
+    // the element enums are assigned in sorted order so sorting
+    // by enum name yields the ID order
+    List<Integer> idList = new ArrayList<Integer>();
+    for (i=0; i<nCnt; i++) {
+      idList.add(Integer.valueOf(i));
+    }
+    Collections.sort(idList, new Comparator<Integer>() {
+        public int compare(Integer one, Integer other) {
+            return mList.get(one.intValue()).getEnum().compareTo(mList.get(other.intValue()).getEnum());
+        }
+    }); 
+    pw.printf("%-32sm_asPage%dIdInd[%d] = {%n", "static const gslc_tsElemIdInd", nPage, nCnt);
+    for (Integer n : idList) {
+      pw.printf("  {%s,%d},%n", mList.get(n.intValue()).getEnum(), n.intValue());
+    }
+    pw.printf("};%n");
+    // only touch-enabled elements (text buttons) need to be in the hit-test buckets
+    int nBucketW = (screenWidth + CONST_BUCKET_GRID - 1) / CONST_BUCKET_GRID;
+    int nBucketH = (screenHeight + CONST_BUCKET_GRID - 1) / CONST_BUCKET_GRID;
+    int[] anBucketStart = new int[CONST_BUCKET_GRID*CONST_BUCKET_GRID+1];
+    List<Integer> bucketList = new ArrayList<Integer>();
+    int nBucket = 0;
+    for (int nRow=0; nRow<CONST_BUCKET_GRID; nRow++) {
+      for (int nCol=0; nCol<CONST_BUCKET_GRID; nCol++) {
+        anBucketStart[nBucket++] = bucketList.size();
+        int nX = nCol * nBucketW;
+        int nY = nRow * nBucketH;
+        for (i=0; i<nCnt; i++) {
+          WidgetModel m = mList.get(i);
+          if (!m.getType().equals(EnumFactory.TEXTBUTTON)) 
+            continue;
+          if ((m.getX() < nX+nBucketW) && (m.getX()+m.getWidth() > nX) &&
+              (m.getY() < nY+nBucketH) && (m.getY()+m.getHeight() > nY)) {
+            bucketList.add(Integer.valueOf(i));
+          }
+        }
+      }
+    }
+    anBucketStart[nBucket] = bucketList.size();
+    String strBuckets = "0,0,0,0,NULL,NULL";
+    if (bucketList.size() > 0) {
+      pw.printf("%-32sm_anPage%dBucketStart[%d] = {", "static const uint16_t", nPage, nBucket+1);
+      for (i=0; i<=nBucket; i++) {
+        pw.printf("%s%d", (i == 0) ? "" : ",", anBucketStart[i]);
+      }
+      pw.printf("};%n");
+      pw.printf("%-32sm_anPage%dBucketInd[%d] = {", "static const uint16_t", nPage, bucketList.size());
+      for (i=0; i<bucketList.size(); i++) {
+        pw.printf("%s%d", (i == 0) ? "" : ",", bucketList.get(i).intValue());
+      }
+      pw.printf("};%n");
+      strBuckets = String.format("%d,%d,%d,%d,m_anPage%dBucketStart,m_anPage%dBucketInd",
+          nBucketW, nBucketH, CONST_BUCKET_GRID, CONST_BUCKET_GRID, nPage, nPage);
+    }
+    pw.printf("%-32sm_sPage%dConst = {%n", "static const gslc_tsPageConst", nPage);
+    pw.printf("  m_asPage%dElemRefConst,MAX_ELEM_%s_CONST,m_asPage%dIdInd,%n", nPage, strEnum, nPage);
+    pw.printf("  %s%n", strBuckets);
+    pw.printf("};%n%n");
+    if (countPageElems(p) > nCnt) {
+      pw.printf("%-32sm_asPage%dElem[MAX_ELEM_%s_RAM];%n", "gslc_tsElem", nPage, strEnum);
+    }
+    pw.printf("%-32sm_asPage%dElemRef[MAX_ELEM_%s];%n", "gslc_tsElemRef", nPage, strEnum);
+  }
+
+  /**
+   * Const element initializer.
+   *
+   * @param m
+   *          the widget model
+   * @return the initializer of the const element
+   */
+  private String constElemInit(WidgetModel m) {
+    String strFont = "";
+    switch(m.getType()) {
+      case "Box":
+        BoxModel b = (BoxModel)m;
+        return String.format("GSLC_ELEM_CONST_BOX(%s,%d,%d,%d,%d,%s,%s,true,true,NULL,NULL)",
+            b.getEnum(), b.getX(), b.getY(), b.getWidth(), b.getHeight(),
+            cf.colorAsString(b.getFrameColor()), cf.colorAsString(b.getFillColor()));
+      case "Text":
+        TextModel t = (TextModel)m;
+        strFont = "&m_asFont[" + getFontIndex(t.getFontEnum()) + "]";
+        return String.format("GSLC_ELEM_CONST_TXT(%s,%d,%d,%d,%d,\"%s\",%s,%s,%s,%s,%s,%s,%s)",
+            t.getEnum(), t.getX(), t.getY(), t.getTargetWidth(), t.getTargetHeight(),
+            t.getText(), strFont, cf.colorAsString(t.getTextColor()),
+            cf.colorAsString(t.getFrameColor()), cf.colorAsString(t.getFillColor()),
+            convertAlignment(t.getAlignment()),
+            t.isFrameEnabled() ? "true" : "false", t.isFillEnabled() ? "true" : "false");
+      default: // must be EnumFactory.TEXTBUTTON
+        TxtButtonModel tb = (TxtButtonModel)m;
+        strFont = "&m_asFont[" + getFontIndex(tb.getFontEnum()) + "]";
+        return String.format("GSLC_ELEM_CONST_BTNTXT(%s,%d,%d,%d,%d,\"%s\",%s,%s,%s,%s,%s,%s,%s,true,%s,&CbBtnCommon,NULL)",
+            tb.getEnum(), tb.getX(), tb.getY(), tb.getWidth(), tb.getHeight(),
+            tb.getText(), strFont, cf.colorAsString(tb.getTextColor()),
+            cf.colorAsString(tb.getFrameColor()), cf.colorAsString(tb.getFillColor()),
+            cf.colorAsString(tb.getFrameColor()), cf.colorAsString(tb.getSelectedColor()),
+            convertAlignment(tb.getAlignment()), tb.isFillEnabled() ? "true" : "false");
+    }
+  }
+
   /**
    * Output button CB.
    *
@@ -3348,6 +3530,66 @@ private List<String> getListOfEnums(List<String> widgetTypes) {
     return count;
   }
 
+  /**
+   * Count the elements of a page.
+   *
+   * @param p
+   *          the page
+   * @return the <code>int</code> object
+   */
+  private int countPageElems(PagePane p) {
+    int count = 0;
+    for (Widget w : p.getWidgets()) {
+      if (w.getType().equals(EnumFactory.TEXTBOX)) {
+        count += 3;  // TEXTBOX has embedded a wrapper Box and a scrollbar along with text box
+      } else {
+        count++;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * Checks if a widget can be placed in a const page table.
+   * Only widgets without extended data, runtime updates or
+   * custom callbacks qualify.
+   *
+   * @param m
+   *          the widget model
+   * @return true, if the widget can be const
+   */
+  private boolean isConstWidget(WidgetModel m) {
+    if (m.getEnum().equals("GSLC_ID_AUTO"))
+      return false;
+    switch(m.getType()) {
+      case "Box":
+        return !((BoxModel)m).hasDrawFunc() && !((BoxModel)m).hasTickFunc();
+      case "Text":
+        return (((TextModel)m).getTextStorage() == 0) && !((TextModel)m).isUTF8();
+      case "TextButton":
+        return (((TxtButtonModel)m).getTextStorage() == 0) && !((TxtButtonModel)m).isUTF8();
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * Gets the widgets of a page that are placed in its const page table.
+   *
+   * @param p
+   *          the page
+   * @return the list of widget models
+   */
+  private List<WidgetModel> getConstWidgets(PagePane p) {
+    List<WidgetModel> mList = new ArrayList<WidgetModel>();
+    for (Widget w : p.getWidgets()) {
+      if (isConstWidget(w.getModel())) {
+        mList.add(w.getModel());
+      }
+    }
+    return mList;
+  }
+
   /**
    * Sort list and remove duplicates.
    *
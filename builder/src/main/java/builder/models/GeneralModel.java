@@ -85,8 +85,11 @@ public class GeneralModel extends WidgetModel {
   /** The Constant GENERAL_MAX_STRING. */
   public static final int GENERAL_MAX_STRING  = 12;
  
+  /** The Constant GENERAL_CONST_PAGES. */
+  public static final int GENERAL_CONST_PAGES = 13;
+ 
   /** The Constant GENERAL_MAX_STRING. */
-  public static final int GENERAL_RECENT_COLORS = 13;
+  public static final int GENERAL_RECENT_COLORS = 14;
  
   /** The themes. */
   List<String> themes;
@@ -129,7 +132,7 @@ public class GeneralModel extends WidgetModel {
   protected void initProperties()
   {
     widgetType = EnumFactory.GENERAL;
-    data = new Object[14][5];
+    data = new Object[15][5];
 
     initProp(PROP_KEY, String.class, "COM-001", Boolean.TRUE,"Key",widgetType);
     initProp(GENERAL_THEME, String.class, "GEN-100", Boolean.FALSE,"Theme",defThemeName);
@@ -150,6 +153,7 @@ public class GeneralModel extends WidgetModel {
     initProp(GENERAL_HSPACING, Integer.class, "GEN-108", Boolean.FALSE,"Horizontal Spacing between widgets",Integer.valueOf(20));
     initProp(GENERAL_VSPACING, Integer.class, "GEN-109", Boolean.FALSE,"Vertical Spacing between widgets",Integer.valueOf(20));
     initProp(GENERAL_MAX_STRING, Integer.class, "GEN-110", Boolean.FALSE,"MAX_STR",Integer.valueOf(100));
+    initProp(GENERAL_CONST_PAGES, Boolean.class, "GEN-112", Boolean.FALSE,"Const Page Tables (linux)",Boolean.FALSE);
     initProp(GENERAL_RECENT_COLORS, String.class, "GEN-111", Boolean.TRUE,"Recent Colors","");
   }
   
@@ -240,6 +244,15 @@ public class GeneralModel extends WidgetModel {
     shortcutValue(s, GENERAL_TARGET);
   }
 
+  /**
+   * Checks if const page tables are generated.
+   *
+   * @return true, if pages are generated as const page tables
+   */
+  public boolean isConstPages() {
+    return ((Boolean) data[GENERAL_CONST_PAGES][PROP_VAL_VALUE]).booleanValue();
+  }
+
   /**
    * Gets the recent colors.
    *
@@ -118,7 +118,7 @@ bool CbDrawScanner(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the background
   gslc_tsRect rInside = pElem->rElem;
   rInside = gslc_ExpandRect(rInside,-1,-1);
-  gslc_DrawFillRect(pGui,rInside,pElem->colElemFill);
+  gslc_DrawFillRect(pGui,rInside,GSLC_ELEM_COL_FILL(pGui,pElem));
 
   // Enable localized clipping
   gslc_SetClipRect(pGui,&rInside);
@@ -141,7 +141,7 @@ bool CbDrawScanner(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   gslc_SetClipRect(pGui,NULL);
 
   // Draw the frame
-  gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+  gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
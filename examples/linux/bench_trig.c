@@ -0,0 +1,125 @@
+//
+// GUIslice Library Examples
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Benchmark (LINUX):
+//     Compare the floating point and lookup table paths of the
+//     fixed-point trigonometric functions (gslc_sinFX, gslc_cosFX)
+//     and the polar coordinate conversions (gslc_PolarToXY,
+//     gslc_PolarToXYBatch) used by the radial gauge
+//     NOTE: The lookup table path that is measured depends on the
+//           GSLC_USE_FLOAT and GSLC_TRIG_LUT_FULL configuration
+//     NOTE: No display is required
+//
+#include "GUIslice.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Number of passes over all angles in a full turn
+#define BENCH_PASSES  200
+
+// Number of angles in a full turn (in units of 1/64 degrees)
+#define BENCH_ANGLES  (360*64)
+
+// Radius used for the polar conversions
+#define BENCH_RAD     120
+
+int16_t     m_an64Ang[BENCH_ANGLES];
+gslc_tsPt   m_asPt[BENCH_ANGLES];
+
+// Accumulate results so that the calculations aren't optimized away
+// - The angles are also offset by the pass number so that the
+//   calculations can't be hoisted out of the pass loop
+volatile int32_t m_nSink = 0;
+
+// Get the current time in nanoseconds
+static double BenchNow()
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (double)sTime.tv_sec*1e9 + sTime.tv_nsec;
+}
+
+// Floating point path (as used by gslc_sinFX() with GSLC_USE_FLOAT=1
+// and GSLC_TRIG_LUT_FULL=0)
+static int16_t BenchSinFloat(int16_t n64Ang)
+{
+  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
+  float fSin = sin(fAngRad);
+  return fSin * 32767.0;
+}
+
+static int16_t BenchCosFloat(int16_t n64Ang)
+{
+  float fAngRad = n64Ang*GSLC_2PI/(360.0*64.0);
+  float fCos = cos(fAngRad);
+  return fCos * 32767.0;
+}
+
+static void BenchReport(const char* pName,double fStart,unsigned nCalls)
+{
+  printf("  %-28s %7.2f ns/call\n",pName,(BenchNow()-fStart)/nCalls);
+}
+
+int main(int argc,char* argv[])
+{
+  unsigned  nPass,nInd;
+  int32_t   nSum = 0;
+  int       nErr,nErrMax = 0;
+  double    fStart;
+
+  for (nInd=0;nInd<BENCH_ANGLES;nInd++) {
+    m_an64Ang[nInd] = nInd;
+  }
+
+  // Compare the accuracy against the floating point path
+  // - This also generates any lookup table before timing starts
+  for (nInd=0;nInd<BENCH_ANGLES;nInd++) {
+    nErr = abs(gslc_sinFX(nInd) - BenchSinFloat(nInd));
+    nErrMax = (nErr > nErrMax)? nErr : nErrMax;
+    nErr = abs(gslc_cosFX(nInd) - BenchCosFloat(nInd));
+    nErrMax = (nErr > nErrMax)? nErr : nErrMax;
+  }
+  printf("Trig benchmark (GSLC_USE_FLOAT=%d, GSLC_TRIG_LUT_FULL=%d)\n",
+    GSLC_USE_FLOAT,GSLC_TRIG_LUT_FULL);
+  printf("  Max error vs float path:     %d / 32767\n",nErrMax);
+
+  fStart = BenchNow();
+  for (nPass=0;nPass<BENCH_PASSES;nPass++) {
+    for (nInd=0;nInd<BENCH_ANGLES;nInd++) {
+      nSum += BenchSinFloat(m_an64Ang[nInd]+nPass) + BenchCosFloat(m_an64Ang[nInd]+nPass);
+    }
+  }
+  BenchReport("sin+cos (float path)",fStart,BENCH_PASSES*BENCH_ANGLES);
+
+  fStart = BenchNow();
+  for (nPass=0;nPass<BENCH_PASSES;nPass++) {
+    for (nInd=0;nInd<BENCH_ANGLES;nInd++) {
+      nSum += gslc_sinFX(m_an64Ang[nInd]+nPass) + gslc_cosFX(m_an64Ang[nInd]+nPass);
+    }
+  }
+  BenchReport("gslc_sinFX+gslc_cosFX",fStart,BENCH_PASSES*BENCH_ANGLES);
+
+  fStart = BenchNow();
+  for (nPass=0;nPass<BENCH_PASSES;nPass++) {
+    for (nInd=0;nInd<BENCH_ANGLES;nInd++) {
+      gslc_PolarToXY(BENCH_RAD,m_an64Ang[nInd]+nPass,&m_asPt[nInd].x,&m_asPt[nInd].y);
+    }
+    nSum += m_asPt[nPass].x;
+  }
+  BenchReport("gslc_PolarToXY",fStart,BENCH_PASSES*BENCH_ANGLES);
+
+  fStart = BenchNow();
+  for (nPass=0;nPass<BENCH_PASSES;nPass++) {
+    gslc_PolarToXYBatch(BENCH_RAD,m_an64Ang,BENCH_ANGLES,m_asPt);
+    nSum += m_asPt[nPass].x;
+  }
+  BenchReport("gslc_PolarToXYBatch",fStart,BENCH_PASSES*BENCH_ANGLES);
+
+  m_nSink = nSum;
+  return 0;
+}
@@ -57,6 +57,13 @@
 
 #include <stdarg.h>         // For va_*
 
+#if (GSLC_FEATURE_LAYOUT)
+  #include <fcntl.h>          // For open()
+  #include <sys/mman.h>       // For mmap()
+  #include <sys/stat.h>       // For fstat()
+  #include <unistd.h>         // For close()
+#endif
+
 // Version tracking
 #include "GUIslice_version.h"
 
@@ -79,6 +86,21 @@ extern uint16_t  m_nLUTSinF0X16[257];
 const char GSLC_PMEM ERRSTR_NULL[]      = "ERROR: %z() called with NULL ptr\n";
 const char GSLC_PMEM ERRSTR_PXD_NULL[]  = "ERROR: %z() pXData NULL\n";
 
+// Default element style (GSLC_STYLE_NONE)
+static const gslc_tsStyle STYLE_DEFAULT = {
+  {255,255,255},{255,255,255},{255,255,255},{255,255,255},{255,255,255},{255,255,255},
+  GSLC_ALIGN_MID_MID,0,NULL
+};
+
+#if (GSLC_STR_ARENA)
+// Each block in the string arena consists of a header followed by
+// the string buffer. The header holds the owner element pointer
+// (NULL if the block is free) and the size class index, and is
+// accessed with memcpy() as the blocks are not aligned.
+#define GSLC_STR_HDR_LEN    (sizeof(gslc_tsElem*)+1)
+#define GSLC_STR_BLK_NONE   0xFFFF
+#endif
+
 
 // ------------------------------------------------------------------------
 // General Functions
@@ -156,6 +178,9 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   }
   pGui->bScreenNeedRedraw  = true;
   pGui->bScreenNeedFlip    = false;
+  gslc_InvalidateRgnReset(pGui);
+  pGui->bClipRectEn        = false;
+  pGui->rClipRect          = (gslc_tsRect){0,0,0,0};
 
   // Initialize collection of fonts with user-supplied pointer
   pGui->asFont      = asFont;
@@ -170,6 +195,49 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   gslc_ResetElem(&(pGui->sElemTmp));
 #endif
 
+  // Initialize shared element pool
+  pGui->asElemPool      = NULL;
+  pGui->nElemPoolMax    = 0;
+  pGui->nElemPoolCnt    = 0;
+  pGui->nElemPoolFree   = GSLC_IND_NONE;
+
+  // Initialize extended data arena
+  pGui->pXDataArena     = NULL;
+  pGui->nXDataArenaSize = 0;
+  pGui->nXDataArenaUsed = 0;
+  pGui->nXDataArenaPeak = 0;
+
+  // Initialize style records
+  pGui->asStyleConst    = NULL;
+  pGui->nStyleConstCnt  = 0;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  pGui->nStyleCnt       = 0;
+  for (nInd=0;nInd<GSLC_STYLE_MAX;nInd++) {
+    pGui->anStyleRef[nInd] = 0;
+  }
+  pGui->nElemImgCnt     = 0;
+  for (nInd=0;nInd<GSLC_ELEM_IMG_MAX;nInd++) {
+    pGui->abElemImgUsed[nInd] = false;
+  }
+  pGui->nElemCbCnt      = 0;
+#endif
+
+  // Initialize element type registry
+  for (nInd=0;nInd<GSLC_ELEMTYPE_MAX;nInd++) {
+    pGui->apElemType[nInd] = NULL;
+  }
+  pGui->nGroupRingCnt   = 0;
+
+  // Initialize string arena
+#if (GSLC_STR_ARENA)
+  pGui->nStrArenaTop    = 0;
+  pGui->nStrArenaUsed   = 0;
+  pGui->nStrArenaPeak   = 0;
+  for (nInd=0;nInd<GSLC_STR_CLASS_CNT;nInd++) {
+    pGui->anStrArenaFree[nInd] = GSLC_STR_BLK_NONE;
+  }
+#endif
+
 
   // Last touch event
   pGui->nTouchLastX           = 0;
@@ -183,6 +251,16 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->nInputMapMax          = 0;
   pGui->nInputMapCnt          = 0;
 
+  pGui->nRedrawDrawCnt        = 0;
+  pGui->nRedrawCullCnt        = 0;
+
+  pGui->bPopupSaveUnderEn     = false;
+  pGui->bPopupSaveValid       = false;
+  pGui->rPopupSave            = (gslc_tsRect){0,0,0,0};
+
+  pGui->nPrerenderMax         = 1;
+  pGui->nPrerenderSeq         = 0;
+
 
   pGui->sImgRefBkgnd = gslc_ResetImage();
 
@@ -853,6 +931,35 @@ bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect)
   return true;
 }
 
+void gslc_UnionRect(gslc_tsRect* pRect,gslc_tsRect rAddRect)
+{
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+  if ((pRect->w == 0) || (pRect->h == 0)) {
+    *pRect = rAddRect;
+    return;
+  }
+  int16_t nX0 = (rAddRect.x < pRect->x)? rAddRect.x : pRect->x;
+  int16_t nY0 = (rAddRect.y < pRect->y)? rAddRect.y : pRect->y;
+  int16_t nX1 = pRect->x + pRect->w;
+  int16_t nY1 = pRect->y + pRect->h;
+  if (rAddRect.x + (int16_t)rAddRect.w > nX1) { nX1 = rAddRect.x + rAddRect.w; }
+  if (rAddRect.y + (int16_t)rAddRect.h > nY1) { nY1 = rAddRect.y + rAddRect.h; }
+  pRect->x = nX0;
+  pRect->y = nY0;
+  pRect->w = nX1-nX0;
+  pRect->h = nY1-nY0;
+}
+
+bool gslc_IsRectInRect(gslc_tsRect rInner,gslc_tsRect rOuter)
+{
+  if ((rInner.x < rOuter.x) || (rInner.y < rOuter.y)) { return false; }
+  if (rInner.x + (int16_t)rInner.w > rOuter.x + (int16_t)rOuter.w) { return false; }
+  if (rInner.y + (int16_t)rInner.h > rOuter.y + (int16_t)rOuter.h) { return false; }
+  return true;
+}
+
 
 
 gslc_tsImgRef gslc_ResetImage()
@@ -918,12 +1025,80 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 }
 
 
+#if (GSLC_TRIG_LUT_FULL)
+// Full-resolution quarter-wave sine table
+// - Entry n holds sin(n/64 degrees) for n in [0 .. 90*64], in the
+//   same fixed-point format as the floating point path of gslc_sinFX()
+// - Generated from the math library on first use
+static int16_t  m_anLUTSinQ[90*64+1];
+static bool     m_bLUTSinQInit = false;
+
+static void gslc_LUTSinQInit(void)
+{
+  uint16_t  nInd;
+  for (nInd=0;nInd<=90*64;nInd++) {
+    float fAngRad = nInd*GSLC_2PI/(360.0*64.0);
+    float fSin = sin(fAngRad);
+    m_anLUTSinQ[nInd] = fSin * 32767.0;
+  }
+  m_bLUTSinQInit = true;
+}
+#endif // GSLC_TRIG_LUT_FULL
+
+#if (GSLC_TRIG_LUT_FULL) || !(GSLC_USE_FLOAT)
+// Fetch the sine of a quarter-phase angle [0 .. 90*64] from the lookup table
+static int16_t gslc_LUTSinQ(uint16_t n64Ang)
+{
+#if (GSLC_TRIG_LUT_FULL)
+  return m_anLUTSinQ[n64Ang];
+#else
+  uint16_t  nLutInd = ((uint32_t)n64Ang * 256)/(90*64);
+  // Leave MSB for the signed bit
+  return m_nLUTSinF0X16[nLutInd] / 2;
+#endif
+}
+#endif
+
+// Calculate the fixed-point sine and cosine of an angle
+// - With the lookup tables, both are derived from a single
+//   reduction of the angle to the first quarter-phase
+static void gslc_SinCosFX(int16_t n64Ang,int16_t* pnSin,int16_t* pnCos)
+{
+#if (GSLC_TRIG_LUT_FULL) || !(GSLC_USE_FLOAT)
+  #if (GSLC_TRIG_LUT_FULL)
+  if (!m_bLUTSinQInit) {
+    gslc_LUTSinQInit();
+  }
+  #endif
+
+  // Support multiple waveform periods and the negative range
+  int32_t   nAng = (int32_t)n64Ang % (int32_t)(360*64);
+  if (nAng < 0) {
+    nAng += 360*64;
+  }
+  // Split into phase and quarter-phase angle [0 .. 90*64)
+  uint8_t   nPhase = nAng / (90*64);
+  uint16_t  nAngQ = nAng - (int32_t)nPhase*(90*64);
+  int16_t   nSinQ = gslc_LUTSinQ(nAngQ);
+  int16_t   nCosQ = gslc_LUTSinQ(90*64 - nAngQ);
+  switch (nPhase) {
+    case 0:   *pnSin =  nSinQ;  *pnCos =  nCosQ;  break;
+    case 1:   *pnSin =  nCosQ;  *pnCos = -nSinQ;  break;
+    case 2:   *pnSin = -nSinQ;  *pnCos = -nCosQ;  break;
+    default:  *pnSin = -nCosQ;  *pnCos =  nSinQ;  break;
+  }
+#else
+  *pnSin = gslc_sinFX(n64Ang);
+  *pnCos = gslc_cosFX(n64Ang);
+#endif
+}
+
 // Sine function with optional lookup table
 int16_t gslc_sinFX(int16_t n64Ang)
 {
   int16_t   nRetValS;
 
-#if (GSLC_USE_FLOAT)
+#if (GSLC_USE_FLOAT) && !(GSLC_TRIG_LUT_FULL)
   // Use floating-point math library function
 
   // Calculate angle in radians
@@ -935,46 +1110,9 @@ int16_t gslc_sinFX(int16_t n64Ang)
   return nRetValS;
 
 #else
-  // TODO: Clean up excess integer typecasting
-
   // Use lookup tables
-  bool bNegate = false;
-
-  // Support multiple waveform periods
-  if (n64Ang >= 360*64) {
-    // For some reason this modulus is broken!
-    n64Ang = (int32_t)n64Ang % (int32_t)(360*64);
-    //n64Ang = n64Ang - (360*64);
-  } else if (n64Ang <= -360*64) {
-    n64Ang = -(-(int32_t)n64Ang % (int32_t)(360*64));
-  }
-  // Handle negative range
-  if (n64Ang < 0) {
-    n64Ang = -n64Ang;
-    bNegate = !bNegate;
-  }
-  // Handle 3rd and 4th phase
-  if (n64Ang >= 180*64) {
-    n64Ang -= 180*64;
-    bNegate = !bNegate;
-  }
-  // Handle 2nd phase
-  if (n64Ang >= 90*64) {
-    n64Ang = 180*64 - n64Ang;
-  }
-
-  // n64Ang is quarter-phase range [0 .. 90*64]
-  // suitable for lookup table indexing
-  uint16_t  nLutInd = ((uint32_t)n64Ang * 256)/(90*64);
-  uint16_t  nLutVal = m_nLUTSinF0X16[nLutInd];
-
-  // Leave MSB for the signed bit
-  nLutVal /= 2;
-  if (bNegate) {
-    nRetValS = -nLutVal;
-  } else {
-    nRetValS = nLutVal;
-  }
+  int16_t   nCosS;
+  gslc_SinCosFX(n64Ang,&nRetValS,&nCosS);
   return nRetValS;
 
 #endif
@@ -984,8 +1122,9 @@ int16_t gslc_sinFX(int16_t n64Ang)
 // Cosine function with optional lookup table
 int16_t gslc_cosFX(int16_t n64Ang)
 {
-#if (GSLC_USE_FLOAT)
   int16_t   nRetValS;
+
+#if (GSLC_USE_FLOAT) && !(GSLC_TRIG_LUT_FULL)
   // Use floating-point math library function
 
   // Calculate angle in radians
@@ -998,8 +1137,9 @@ int16_t gslc_cosFX(int16_t n64Ang)
 
 #else
   // Use lookup tables
-  // Cosine function is equivalent to Sine shifted by 90 degrees
-  return gslc_sinFX(n64Ang+90*64);
+  int16_t   nSinS;
+  gslc_SinCosFX(n64Ang,&nSinS,&nRetValS);
+  return nRetValS;
 
 #endif
 
@@ -1008,12 +1148,21 @@ int16_t gslc_cosFX(int16_t n64Ang)
 // Convert from polar to cartesian
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY)
 {
-  int32_t nTmp;
-  // TODO: Clean up excess integer typecasting
-  nTmp = (int32_t)nRad *  gslc_sinFX(n64Ang);
-  *nDX = nTmp / 32767;
-  nTmp = (int32_t)nRad * -gslc_cosFX(n64Ang);
-  *nDY = nTmp / 32767;
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  *nDX = ((int32_t)nRad *  nSin) / 32767;
+  *nDY = ((int32_t)nRad * -nCos) / 32767;
+}
+
+void gslc_PolarToXYBatch(uint16_t nRad,const int16_t* an64Ang,uint16_t nCnt,gslc_tsPt* asPt)
+{
+  uint16_t  nInd;
+  int16_t   nSin,nCos;
+  for (nInd=0;nInd<nCnt;nInd++) {
+    gslc_SinCosFX(an64Ang[nInd],&nSin,&nCos);
+    asPt[nInd].x = ((int32_t)nRad *  nSin) / 32767;
+    asPt[nInd].y = ((int32_t)nRad * -nCos) / 32767;
+  }
 }
 
 // Call with nMidAmt=500 to create simple linear blend between two colors
@@ -1156,10 +1305,12 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 void gslc_DrawLinePolar(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nRadStart,uint16_t nRadEnd,int16_t n64Ang,gslc_tsColor nCol)
 {
   // Draw the ray representing the current value
-  int16_t nDxS = (int32_t)nRadStart * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyS = (int32_t)nRadStart * gslc_cosFX(n64Ang)/32768;
-  int16_t nDxE = (int32_t)nRadEnd   * gslc_sinFX(n64Ang)/32768;
-  int16_t nDyE = (int32_t)nRadEnd   * gslc_cosFX(n64Ang)/32768;
+  int16_t nSin,nCos;
+  gslc_SinCosFX(n64Ang,&nSin,&nCos);
+  int16_t nDxS = (int32_t)nRadStart * nSin/32768;
+  int16_t nDyS = (int32_t)nRadStart * nCos/32768;
+  int16_t nDxE = (int32_t)nRadEnd   * nSin/32768;
+  int16_t nDyE = (int32_t)nRadEnd   * nCos/32768;
   gslc_DrawLine(pGui,nX+nDxS,nY-nDyS,nX+nDxE,nY-nDyE,nCol);
 }
 
@@ -1215,6 +1366,57 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 }
 
 
+void gslc_DrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColor nCol)
+{
+  if (nSpanCnt == 0) {
+    return;
+  }
+
+#if (DRV_HAS_DRAW_SPANS)
+  // Call optimized driver implementation
+  gslc_DrvDrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+#else
+  // Emulate it with a single-row fill per span
+  uint16_t nInd;
+  for (nInd=0;nInd<nSpanCnt;nInd++) {
+    if (asSpan[nInd].nW == 0) {
+      continue;
+    }
+  #if (DRV_HAS_DRAW_RECT_FILL)
+    gslc_tsRect rSpan = (gslc_tsRect){asSpan[nInd].nX,asSpan[nInd].nY,asSpan[nInd].nW,1};
+    gslc_DrvDrawFillRect(pGui,rSpan,nCol);
+  #else
+    gslc_DrawLineH(pGui,asSpan[nInd].nX,asSpan[nInd].nY,asSpan[nInd].nW,nCol);
+  #endif
+  }
+#endif
+
+  gslc_PageFlipSet(pGui,true);
+}
+
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  // Ensure dimensions are valid
+  if ((rSrc.w == 0) || (rSrc.h == 0)) {
+    return true;
+  }
+
+#if (DRV_HAS_DRAW_RECT_COPY)
+  // Call optimized driver implementation
+  if (!gslc_DrvDrawCopyRect(pGui,rSrc,nDstX,nDstY)) {
+    return false;
+  }
+  gslc_PageFlipSet(pGui,true);
+  return true;
+#else
+  // No emulation is available since it would require
+  // reading back pixels from the display. Callers are
+  // expected to fall back to a redraw of the region.
+  return false;
+#endif
+}
+
+
 // Expand or contract a rectangle in width and/or height (equal
 // amounts on both side), based on the centerpoint of the rectangle.
 gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
@@ -1314,9 +1516,186 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   gslc_PageFlipSet(pGui,true);
 }
 
+void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
+{
+  int16_t nSwapX,nSwapY;
+  nSwapX = *pnXa;
+  nSwapY = *pnYa;
+  *pnXa = *pnXb;
+  *pnYa = *pnYb;
+  *pnXb = nSwapX;
+  *pnYb = nSwapY;
+}
+
+#if (!DRV_HAS_DRAW_CIRCLE_FILL) || (!DRV_HAS_DRAW_TRI_FILL)
+// -----------------------------------------------------------------------
+// Span rasterizer
+// - Filled shapes that the driver can't draw natively are emulated
+//   by generating the horizontal span covered on each row. The
+//   spans are collected into batches for gslc_DrawFillSpans() so
+//   that the driver can fill many rows per call rather than
+//   drawing each row as a separate line.
+// -----------------------------------------------------------------------
+
+// Number of spans collected before they are drawn
+#define GSLC_SPAN_BUF_MAX 16
+
+// Batch of spans waiting to be drawn
+typedef struct {
+  gslc_tsSpan   asSpan[GSLC_SPAN_BUF_MAX];  // Pending spans
+  uint16_t      nSpanCnt;                   // Number of pending spans
+  gslc_tsColor  nCol;                       // Fill color
+} gslc_tsSpanBuf;
+
+// Draw any pending spans
+static void gslc_SpanFlush(gslc_tsGui* pGui,gslc_tsSpanBuf* pBuf)
+{
+  gslc_DrawFillSpans(pGui,pBuf->asSpan,pBuf->nSpanCnt,pBuf->nCol);
+  pBuf->nSpanCnt = 0;
+}
+
+// Add the span between two endpoints on a row
+// - The endpoints are inclusive and may be given in either order
+static void gslc_SpanAdd(gslc_tsGui* pGui,gslc_tsSpanBuf* pBuf,int16_t nXa,int16_t nXb,int16_t nY)
+{
+  gslc_tsSpan* pSpan = &pBuf->asSpan[pBuf->nSpanCnt];
+  if (nXa > nXb) {
+    int16_t nSwap = nXa; nXa = nXb; nXb = nSwap;
+  }
+  pSpan->nX = nXa;
+  pSpan->nY = nY;
+  pSpan->nW = (uint16_t)(nXb-nXa+1);
+  pBuf->nSpanCnt++;
+  if (pBuf->nSpanCnt >= GSLC_SPAN_BUF_MAX) {
+    gslc_SpanFlush(pGui,pBuf);
+  }
+}
+#endif // !DRV_HAS_DRAW_CIRCLE_FILL || !DRV_HAS_DRAW_TRI_FILL
+
+#if (!DRV_HAS_DRAW_TRI_FILL)
+// Triangle edge, walked one row at a time
+// - Tracks X = nX0 + (nY-nY0)*(nX1-nX0)/(nY1-nY0) for successive
+//   rows, rounded half away from zero, using only additions per row.
+//   The rounding is symmetric so that two triangles sharing an edge
+//   (eg. in a filled quad) don't leave a seam between them.
+typedef struct {
+  int16_t   nX0;      // X coordinate of base vertex
+  int8_t    nSign;    // Sign of the X offset from the base vertex
+  int8_t    nStep;    // Change in offset magnitude per row (+1 or -1)
+  int32_t   nQuot;    // Magnitude of the current X offset
+  int32_t   nRem;     // Remainder of the current X offset
+  int32_t   nDen;     // Denominator for the remainder (2*|nY1-nY0|)
+  int32_t   nIncQuot; // Increment of the quotient per row
+  int32_t   nIncRem;  // Increment of the remainder per row
+} gslc_tsSpanEdge;
+
+// Start walking the edge from base vertex (nX0,nY0) to (nX1,nY1) at row nY
+// - The rows walked must not cross the base vertex row
+// - Requires nY0 != nY1
+static void gslc_SpanEdgeInit(gslc_tsSpanEdge* pEdge,int16_t nX0,int16_t nY0,
+  int16_t nX1,int16_t nY1,int16_t nY)
+{
+  int32_t nDX   = nX1-nX0;
+  int32_t nDY   = nY1-nY0;
+  int32_t nOfs  = nY-nY0;
+  int32_t nNum;
+
+  pEdge->nX0    = nX0;
+  pEdge->nStep  = (nOfs >= 0)? 1 : -1;
+  pEdge->nSign  = ((nDX >= 0) == (nDY >= 0))? pEdge->nStep : -pEdge->nStep;
+  nDX   = (nDX >= 0)? nDX : -nDX;
+  nDY   = (nDY >= 0)? nDY : -nDY;
+  nOfs  = (nOfs >= 0)? nOfs : -nOfs;
+
+  // Offset magnitude is floor((2*|nOfs|*|nDX| + |nDY|) / (2*|nDY|))
+  nNum            = 2*nOfs*nDX + nDY;
+  pEdge->nDen     = 2*nDY;
+  pEdge->nQuot    = nNum / pEdge->nDen;
+  pEdge->nRem     = nNum % pEdge->nDen;
+  pEdge->nIncQuot = (2*nDX) / pEdge->nDen;
+  pEdge->nIncRem  = (2*nDX) % pEdge->nDen;
+}
+
+// Get the X coordinate of the edge on the current row
+static int16_t gslc_SpanEdgeX(gslc_tsSpanEdge* pEdge)
+{
+  return (int16_t)(pEdge->nX0 + pEdge->nSign*pEdge->nQuot);
+}
+
+// Advance the edge to the next row
+static void gslc_SpanEdgeNext(gslc_tsSpanEdge* pEdge)
+{
+  if (pEdge->nStep > 0) {
+    pEdge->nQuot += pEdge->nIncQuot;
+    pEdge->nRem  += pEdge->nIncRem;
+    if (pEdge->nRem >= pEdge->nDen) {
+      pEdge->nRem -= pEdge->nDen;
+      pEdge->nQuot++;
+    }
+  } else {
+    pEdge->nQuot -= pEdge->nIncQuot;
+    pEdge->nRem  -= pEdge->nIncRem;
+    if (pEdge->nRem < 0) {
+      pEdge->nRem += pEdge->nDen;
+      pEdge->nQuot--;
+    }
+  }
+}
+
+// Rasterize a filled triangle into spans
+// - Algorithm:
+//   - Sort the vertices in descending vertical position
+//     (nY0 >= nY1 >= nY2) so that the triangle divides into a
+//     flat bottom and a flat top portion at Y=Y1
+//   - Walk the long edge (V0-V2) and the short edges (V1-V2 for
+//     the top portion, V1-V0 for the bottom portion) down each
+//     row and output the span between them
+// - The rows from nY2 up to (but excluding) nY0 are covered
+static void gslc_SpanTriangle(gslc_tsGui* pGui,gslc_tsSpanBuf* pBuf,int16_t nX0,int16_t nY0,
+    int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2)
+{
+  gslc_tsSpanEdge sEdgeLong;
+  gslc_tsSpanEdge sEdgeShort;
+  int16_t         nY;
+
+  // Sort vertices
+  // - Want nY0 >= nY1 >= nY2
+  if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
+  if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
+  if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
+
+  // Nothing to fill for a degenerate (flat) triangle
+  if (nY0 == nY2) {
+    return;
+  }
+
+  gslc_SpanEdgeInit(&sEdgeLong,nX0,nY0,nX2,nY2,nY2);
+
+  // Flat top portion
+  if (nY1 > nY2) {
+    gslc_SpanEdgeInit(&sEdgeShort,nX1,nY1,nX2,nY2,nY2);
+    for (nY=nY2;nY<nY1;nY++) {
+      gslc_SpanAdd(pGui,pBuf,gslc_SpanEdgeX(&sEdgeShort),gslc_SpanEdgeX(&sEdgeLong),nY);
+      gslc_SpanEdgeNext(&sEdgeShort);
+      gslc_SpanEdgeNext(&sEdgeLong);
+    }
+  }
+
+  // Flat bottom portion
+  if (nY0 > nY1) {
+    gslc_SpanEdgeInit(&sEdgeShort,nX1,nY1,nX0,nY0,nY1);
+    for (nY=nY1;nY<nY0;nY++) {
+      gslc_SpanAdd(pGui,pBuf,gslc_SpanEdgeX(&sEdgeShort),gslc_SpanEdgeX(&sEdgeLong),nY);
+      gslc_SpanEdgeNext(&sEdgeShort);
+      gslc_SpanEdgeNext(&sEdgeLong);
+    }
+  }
+}
+#endif // !DRV_HAS_DRAW_TRI_FILL
+
 // Draw a filled circle using midpoint circle algorithm
 // - Algorithm reference: https://en.wikipedia.org/wiki/Midpoint_circle_algorithm
-// - Adapted for fill by connecting points by lines
+// - Adapted for fill by outputting the span between reflected points
 // - No separate frame color is performed
 void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
   uint16_t nRadius,gslc_tsColor nCol)
@@ -1326,33 +1705,32 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
     // Call optimized driver implementation
     gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
   #else
-    // Emulate circle with line drawing
+    // Emulate circle with spans
+    // - Each row is output only once, at its widest extent
+
+    gslc_tsSpanBuf sBuf;
+    sBuf.nSpanCnt = 0;
+    sBuf.nCol     = nCol;
 
     int16_t nX    = nRadius;  // a
     int16_t nY    = 0;        // b
     int16_t nErr  = 0;
+    int16_t nXPrev,nYPrev;
 
     while (nX >= nY)
     {
 
       // Connect pairs of the reflected points around the circumference
 
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);  // (-b,+a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);  // (+b,+a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY+nX,nMidX+nY,nMidY+nX,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY + nY,nCol);  // (-a,+b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);  // (+a,+b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY+nY,nMidX+nX,nMidY+nY,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nX, nMidY - nY,nCol);  // (-a,-b)
-      //gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY - nY,nCol);  // (+a,-b)
-      gslc_DrawLine(pGui,nMidX-nX,nMidY-nY,nMidX+nX,nMidY-nY,nCol);
-
-      //gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY - nX,nCol);  // (-b,-a)
-      //gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY - nX,nCol);  // (+b,-a)
-      gslc_DrawLine(pGui,nMidX-nY,nMidY-nX,nMidX+nY,nMidY-nX,nCol);
+      // Rows at (+/-b) are each visited once
+      // - (-a,+b) to (+a,+b) and (-a,-b) to (+a,-b)
+      gslc_SpanAdd(pGui,&sBuf,nMidX-nX,nMidX+nX,nMidY+nY);
+      if (nY != 0) {
+        gslc_SpanAdd(pGui,&sBuf,nMidX-nX,nMidX+nX,nMidY-nY);
+      }
 
+      nXPrev = nX;
+      nYPrev = nY;
 
       nY    += 1;
       nErr  += 1 + 2*nY;
@@ -1361,8 +1739,20 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
           nX -= 1;
           nErr += 1 - 2*nX;
       }
+
+      // Rows at (+/-a) are visited with increasing width until
+      // a changes, so only the last (widest) one is output
+      // - (-b,+a) to (+b,+a) and (-b,-a) to (+b,-a)
+      // - Skip it where it coincides with a row at (+/-b)
+      if ((nX != nXPrev) || (nX < nY)) {
+        if (nXPrev > nYPrev) {
+          gslc_SpanAdd(pGui,&sBuf,nMidX-nYPrev,nMidX+nYPrev,nMidY+nXPrev);
+          gslc_SpanAdd(pGui,&sBuf,nMidX-nYPrev,nMidX+nYPrev,nMidY-nXPrev);
+        }
+      }
     } // while
 
+    gslc_SpanFlush(pGui,&sBuf);
 
   #endif
 
@@ -1389,18 +1779,6 @@ void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
   gslc_PageFlipSet(pGui,true);
 }
 
-void gslc_SwapCoords(int16_t* pnXa,int16_t* pnYa,int16_t* pnXb,int16_t* pnYb)
-{
-  int16_t nSwapX,nSwapY;
-  nSwapX = *pnXa;
-  nSwapY = *pnYa;
-  *pnXa = *pnXb;
-  *pnYa = *pnYb;
-  *pnXb = nSwapX;
-  *pnYb = nSwapY;
-}
-
-
 // Draw a filled triangle
 void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     int16_t nX1,int16_t nY1,int16_t nX2,int16_t nY2,gslc_tsColor nCol)
@@ -1411,78 +1789,12 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
     gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
 
   #else
-    // Emulate triangle fill
-
-    // Algorithm:
-    // - An arbitrary triangle is cut into two portions:
-    //   1) a flat bottom triangle
-    //   2) a flat top triangle
-    // - Sort the vertices in descending vertical position.
-    //   This serves two purposes:
-    //   1) ensures that the division between the flat bottom
-    //      and flat top triangles occurs at Y=Y1
-    //   2) ensure that we avoid division-by-zero in the for loops
-    // - Walk each scan line and determine the intersection
-    //   between triangle side A & B (flat bottom triangle)
-    //   and then C and B (flat top triangle) using line slopes.
-
-    // Sort vertices
-    // - Want nY0 >= nY1 >= nY2
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-    if (nY1>nY0) { gslc_SwapCoords(&nX0,&nY0,&nX1,&nY1); }
-    if (nY2>nY1) { gslc_SwapCoords(&nX2,&nY2,&nX1,&nY1); }
-
-    // TODO: It is more efficient to calculate row endpoints
-    // using incremental additions instead of multiplies/divides
-
-    int16_t nXa,nXb,nXc,nYos;
-    int16_t nX01,nX20,nY01,nY20,nX21,nY21;
-    nX01 = nX0-nX1; nY01 = nY0-nY1;
-    nX20 = nX2-nX0; nY20 = nY2-nY0;
-    nX21 = nX2-nX1; nY21 = nY2-nY1;
-
-    // Flat bottom scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY0 == nY1 or nY2
-    for (nYos=0;nYos<nY01;nYos++) {
-      // Determine row endpoints (no rounding)
-      //nXa = (nYos          )*(nX0-nX1)/(nY0-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXa  = 2*(nYos)*nX01;
-      nXa += (nXa>=0)?abs(nY01):-abs(nY01);
-      nXa /= 2*nY01;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXa,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
-
-    // Flat top scenario
-    // NOTE: Due to vertex sorting and loop range, it shouldn't
-    // be possible to enter loop when nY2 == nY0 or nY1
-    for (nYos=nY21;nYos<0;nYos++) {
-
-      // Determine row endpoints (no rounding)
-      //nXc = (nYos          )*(nX2-nX1)/(nY2-nY1);
-      //nXb = (nYos-(nY0-nY1))*(nX2-nX0)/(nY2-nY0);
-
-      // Determine row endpoints (using rounding)
-      nXc  = 2*(nYos)*nX21;
-      nXc += (nXc>=0)?abs(nY21):-abs(nY21);
-      nXc /= 2*nY21;
-
-      nXb = 2*(nYos-nY01)*nX20;
-      nXb += (nXb>=0)?abs(nY20):-abs(nY20);
-      nXb /= 2*nY20;
-
-      // Draw horizontal line between endpoints
-      gslc_DrawLine(pGui,nX1+nXc,nY1+nYos,nX0+nXb,nY1+nYos,nCol);
-    }
+    // Emulate triangle fill with spans
+    gslc_tsSpanBuf sBuf;
+    sBuf.nSpanCnt = 0;
+    sBuf.nCol     = nCol;
+    gslc_SpanTriangle(pGui,&sBuf,nX0,nY0,nX1,nY1,nX2,nY2);
+    gslc_SpanFlush(pGui,&sBuf);
 
   #endif  // DRV_HAS_DRAW_TRI_FILL
 
@@ -1515,17 +1827,34 @@ void gslc_DrawFillQuad(gslc_tsGui* pGui,gslc_tsPt* psPt,gslc_tsColor nCol)
 {
   int16_t nX0,nY0,nX1,nY1,nX2,nY2;
 
+  #if (!DRV_HAS_DRAW_TRI_FILL)
+    // Collect the spans of both triangles into a single batch
+    gslc_tsSpanBuf sBuf;
+    sBuf.nSpanCnt = 0;
+    sBuf.nCol     = nCol;
+  #endif
+
   // Break down quadrilateral into two triangles
   nX0 = psPt[0].x; nY0 = psPt[0].y;
   nX1 = psPt[1].x; nY1 = psPt[1].y;
   nX2 = psPt[2].x; nY2 = psPt[2].y;
-  gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  #if (DRV_HAS_DRAW_TRI_FILL)
+    gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  #else
+    gslc_SpanTriangle(pGui,&sBuf,nX0,nY0,nX1,nY1,nX2,nY2);
+  #endif
 
   nX0 = psPt[2].x; nY0 = psPt[2].y;
   nX1 = psPt[0].x; nY1 = psPt[0].y;
   nX2 = psPt[3].x; nY2 = psPt[3].y;
-  gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  #if (DRV_HAS_DRAW_TRI_FILL)
+    gslc_DrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
+  #else
+    gslc_SpanTriangle(pGui,&sBuf,nX0,nY0,nX1,nY1,nX2,nY2);
+    gslc_SpanFlush(pGui,&sBuf);
+  #endif
 
+  gslc_PageFlipSet(pGui,true);
 }
 
 
@@ -1634,6 +1963,19 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
   // Assign the requested Page ID
   pPage->nPageId = nPageId;
 
+  // Static layer cache is disabled by default
+  pPage->bStaticLayerEn     = false;
+  pPage->bStaticLayerValid  = false;
+  pPage->nStaticLayerBase   = GSLC_PAGE_NONE;
+  pPage->pvStaticLayer      = NULL;
+
+  pPage->bPrerenderValid    = false;
+  pPage->nPrerenderBase     = GSLC_PAGE_NONE;
+  pPage->nPrerenderSeq      = 0;
+  pPage->pvPrerender        = NULL;
+
+  pPage->nXDataMark         = GSLC_XDATA_MARK_NONE;
+
   // Increment the page count
   pGui->nPageCnt++;
 
@@ -1651,481 +1993,2376 @@ void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t
 
 }
 
-int gslc_GetPageCur(gslc_tsGui* pGui)
+bool gslc_PageAddConst(gslc_tsGui* pGui,int16_t nPageId,const gslc_tsPageConst* pPageConst,
+        gslc_tsElem* psElem,uint16_t nMaxElem,gslc_tsElemRef* psElemRef,uint16_t nMaxElemRef)
 {
-  gslc_tsPage* pStackPage = pGui->apPageStack[GSLC_STACK_CUR];
-  if (pStackPage == NULL) {
-    return GSLC_PAGE_NONE;
+  if ((pGui == NULL) || (pPageConst == NULL) || (psElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "PageAddConst";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
   }
-  return pStackPage->nPageId;
-}
-
-void gslc_SetStackPage(gslc_tsGui* pGui, uint8_t nStackPos, int16_t nPageId)
-{
-  int16_t nPageSaved = GSLC_PAGE_NONE;
-  gslc_tsPage* pStackPage = pGui->apPageStack[nStackPos];
-  if (pStackPage != NULL) {
-    nPageSaved = pStackPage->nPageId;
+  if (pPageConst->nElemRefCnt > nMaxElemRef) {
+    GSLC_DEBUG_PRINT("ERROR: PageAddConst(%s) element reference array too small\n","");
+    return false;
   }
-
-  gslc_tsPage* pPage = NULL;
-  if (nPageId == GSLC_PAGE_NONE) {
-    // Disable the page
-    #if defined(DEBUG_LOG)
-    GSLC_DEBUG_PRINT("INFO: Disabled PageStack[%u]\n",nStackPos);
-    #endif
-    pPage = NULL;
-  } else {
-
-    // Find the page
-    pPage = gslc_PageFindById(pGui, nPageId);
-    if (pPage == NULL) {
-      GSLC_DEBUG_PRINT("ERROR: SetStackPage() can't find page (ID=%d)\n", nPageId);
-      return;
-    }
+  if (pGui->nPageCnt+1 > (pGui->nPageMax)) {
+    GSLC_DEBUG_PRINT("ERROR: PageAddConst(%s) added too many pages\n","");
+    return false;
   }
 
-  // Save a reference to the selected page
-  pGui->apPageStack[nStackPos] = pPage;
+  gslc_PageAdd(pGui,nPageId,psElem,nMaxElem,psElemRef,nMaxElemRef);
 
-  #if defined(DEBUG_LOG)
-  GSLC_DEBUG_PRINT("INFO: Changed PageStack[%u] to page %u\n",nStackPos,nPageId);
-  #endif
+  // Take the element references from the table. The elements
+  // themselves are referenced in place.
+  gslc_tsCollect* pCollect = &pGui->asPage[pGui->nPageCnt-1].sCollect;
+  memcpy(psElemRef,pPageConst->asElemRef,pPageConst->nElemRefCnt*sizeof(gslc_tsElemRef));
+  pCollect->nElemRefCnt = pPageConst->nElemRefCnt;
+  pCollect->pPageConst  = pPageConst;
 
-  // A change of page should always force a future redraw
-  if (nPageSaved != nPageId) {
-    gslc_PageRedrawSet(pGui,true);
-  }
+  return true;
 }
 
-
-void gslc_SetStackState(gslc_tsGui* pGui, uint8_t nStackPos, bool bActive, bool bDoDraw)
+#if (GSLC_FEATURE_LAYOUT)
+// Layout flags that describe the element layout of this build
+static uint8_t gslc_LayoutFlags(void)
 {
-  gslc_tsPage* pStackPage = pGui->apPageStack[nStackPos];
-  if (pStackPage == NULL) {
-    // TODO: Error
-    return;
-  }
-  pGui->abPageStackActive[nStackPos] = bActive;
-  pGui->abPageStackDoDraw[nStackPos] = bDoDraw;
+  uint8_t nFlags = 0;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  nFlags |= GSLC_LAYOUT_FLAG_COMPACT;
+#endif
+#if (GSLC_LOCAL_STR) && !(GSLC_STR_ARENA)
+  nFlags |= GSLC_LAYOUT_FLAG_LOCAL_STR;
+#endif
+  return nFlags;
 }
 
-void gslc_SetPageBase(gslc_tsGui* pGui, int16_t nPageId)
+// Compare a callback (0=draw,1=touch,2=tick) of two callback records
+static bool gslc_LayoutCbEqual(const gslc_tsElemType* pCbA,const gslc_tsElemType* pCbB,uint8_t nField)
 {
-  gslc_SetStackPage(pGui, GSLC_STACK_BASE, nPageId);
+  switch (nField) {
+    case 0:   return (pCbA->pfuncXDraw == pCbB->pfuncXDraw);
+    case 1:   return (pCbA->pfuncXTouch == pCbB->pfuncXTouch);
+    default:  return (pCbA->pfuncXTick == pCbB->pfuncXTick);
+  }
 }
 
-void gslc_SetPageCur(gslc_tsGui* pGui,int16_t nPageId)
+// Copy a callback (0=draw,1=touch,2=tick) between callback records
+static void gslc_LayoutCbCopy(gslc_tsElemType* pCbDst,const gslc_tsElemType* pCbSrc,uint8_t nField)
 {
-  gslc_SetStackPage(pGui, GSLC_STACK_CUR, nPageId);
+  switch (nField) {
+    case 0:   pCbDst->pfuncXDraw  = pCbSrc->pfuncXDraw;   break;
+    case 1:   pCbDst->pfuncXTouch = pCbSrc->pfuncXTouch;  break;
+    default:  pCbDst->pfuncXTick  = pCbSrc->pfuncXTick;   break;
+  }
 }
 
-void gslc_SetPageOverlay(gslc_tsGui* pGui,int16_t nPageId)
+// Build the fixup record of an element
+// - The string offsets are allocated from *pnStrLen, which is
+//   advanced by the size of the element's strings
+// - Returns false if the element can't be saved
+static bool gslc_LayoutElemFix(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsElemType* asCb,uint8_t nCbCnt,
+  gslc_tsLayoutElem* pFix,uint32_t* pnStrLen)
 {
-  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
-}
+  gslc_tsElemType sCb;
+  gslc_tsElemType sCbNone = {GSLC_TYPE_NONE,NULL,NULL,NULL};
+  uint8_t         nField,nInd;
 
-void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
-{
-  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
-  // If modal dialog selected, then deactivate other pages in stack
-  // If modeless dialog selected, then don't deactivate other pages in stack
-  if (bModal) {
-    // Modal: deactive other pages and disable redraw
-    gslc_SetStackState(pGui, GSLC_STACK_CUR, false, false);
-    gslc_SetStackState(pGui, GSLC_STACK_BASE, false, false);
+  if ((pElem->pXData != NULL) || (pElem->pElemRefParent != NULL)) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutSave() can't save extended element (ID=%d)\n",pElem->nId);
+    return false;
   }
-  else {
-    // Modeless: activate other pages but disable redraw
-    gslc_SetStackState(pGui, GSLC_STACK_CUR, true, false);
-    gslc_SetStackState(pGui, GSLC_STACK_BASE, true, false);
+
+  // Text
+  pFix->nStrOfs = GSLC_LAYOUT_NONE;
+#if !((GSLC_LOCAL_STR) && !(GSLC_STR_ARENA))
+  if (pElem->pStrBuf != NULL) {
+    // Keep the full buffer so that the text remains updatable
+    size_t nLen = strlen(pElem->pStrBuf)+1;
+    pFix->nStrOfs = *pnStrLen;
+    *pnStrLen += (nLen > pElem->nStrBufMax)? nLen : pElem->nStrBufMax;
   }
-}
+#endif
 
-void gslc_PopupHide(gslc_tsGui* pGui)
-{
-  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
-  // Ensure other pages in stack are activated
-  // - This is done in case they were deactivated due to a modal popup
-  gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
-  gslc_SetStackState(pGui, GSLC_STACK_BASE, true, true);
-}
+  // Images
+  for (nInd=0;nInd<2;nInd++) {
+    gslc_tsImgRef sImgRef = (nInd == 0)? GSLC_ELEM_IMG_NORM(pElem) : GSLC_ELEM_IMG_GLOW(pElem);
+    pFix->anImgOfs[nInd]    = GSLC_LAYOUT_NONE;
+    pFix->aeImgFlags[nInd]  = GSLC_IMGREF_NONE;
+    if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_NONE) {
+      continue;
+    }
+    if (((sImgRef.eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_SRC_FILE) || (sImgRef.pFname == NULL)) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutSave() image must be sourced from a file (ID=%d)\n",pElem->nId);
+      return false;
+    }
+    pFix->anImgOfs[nInd]    = *pnStrLen;
+    pFix->aeImgFlags[nInd]  = (uint16_t)sImgRef.eImgFlags;
+    *pnStrLen += strlen(sImgRef.pFname)+1;
+  }
 
+  // Callbacks
+  gslc_ElemCbOvrGet(pGui,pElem,&sCb);
+  for (nField=0;nField<3;nField++) {
+    pFix->anCb[nField] = 0;
+    if (gslc_LayoutCbEqual(&sCb,&sCbNone,nField)) {
+      continue;
+    }
+    for (nInd=0;nInd<nCbCnt;nInd++) {
+      if (gslc_LayoutCbEqual(&sCb,&asCb[nInd],nField)) {
+        break;
+      }
+    }
+    if (nInd >= nCbCnt) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutSave() callback not in callback table (ID=%d)\n",pElem->nId);
+      return false;
+    }
+    pFix->anCb[nField] = nInd+1;
+  }
 
-// Adjust the flag that indicates whether the entire page
-// requires a redraw.
-void gslc_PageRedrawSet(gslc_tsGui* pGui,bool bRedraw)
+  pFix->eElemFlags  = 0;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  pFix->nFontId     = GSLC_FONT_NONE;
+#else
+  pFix->nFontId     = (pElem->pTxtFont == NULL)? GSLC_FONT_NONE : pElem->pTxtFont->nId;
+#endif
+  return true;
+}
+
+// Write a block to a layout file, advancing the file offset
+static bool gslc_LayoutWrite(FILE* pFile,const void* pvData,uint32_t nLen,uint32_t* pnOfs)
 {
-  if (pGui == NULL) {
-    return;
+  if ((nLen > 0) && (fwrite(pvData,1,nLen,pFile) != nLen)) {
+    return false;
   }
+  *pnOfs += nLen;
+  return true;
+}
 
-  pGui->bScreenNeedRedraw = bRedraw;
+// Pad a layout file with zeros up to an offset
+static bool gslc_LayoutPad(FILE* pFile,uint32_t nOfsEnd,uint32_t* pnOfs)
+{
+  for (;*pnOfs<nOfsEnd;(*pnOfs)++) {
+    if (fputc(0,pFile) == EOF) {
+      return false;
+    }
+  }
+  return true;
 }
 
-bool gslc_PageRedrawGet(gslc_tsGui* pGui)
+// Round a layout file offset up to the alignment of the element records
+#define GSLC_LAYOUT_ALIGN(nOfs)   (((nOfs)+7) & ~(uint32_t)7)
+
+bool gslc_LayoutSave(gslc_tsGui* pGui,const char* pFname,const gslc_tsElemType* asCb,uint8_t nCbCnt)
 {
-  if (pGui == NULL) {
+  if ((pGui == NULL) || (pFname == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "LayoutSave";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return false;
   }
 
-  return pGui->bScreenNeedRedraw;
+  gslc_tsLayoutHdr  sHdr;
+  gslc_tsLayoutPage sPage;
+  gslc_tsLayoutElem sFix;
+  gslc_tsElem       sElem;
+  gslc_tsElemRef*   pElemRef;
+  gslc_tsElem*      pElem;
+  gslc_tsCollect*   pCollect;
+  uint32_t          nStrLen = 0;
+  uint32_t          nOfs;
+  uint16_t          nPageInd,nInd;
+
+  memset(&sHdr,0,sizeof(sHdr));
+  sHdr.nMagic     = GSLC_LAYOUT_MAGIC;
+  sHdr.nVersion   = GSLC_LAYOUT_VERSION;
+  sHdr.nElemSize  = sizeof(gslc_tsElem);
+  sHdr.nStyleSize = sizeof(gslc_tsStyle);
+  sHdr.nPtrSize   = sizeof(void*);
+  sHdr.nFlags     = gslc_LayoutFlags();
+  sHdr.nPageCnt   = pGui->nPageCnt;
+  sHdr.nStyleCnt  = pGui->nStyleConstCnt;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  // The runtime style records are saved as part of the style table
+  sHdr.nStyleCnt += pGui->nStyleCnt;
+#endif
+
+  // Determine the file layout and check that all elements can be saved
+  nOfs = sizeof(gslc_tsLayoutHdr);
+  sHdr.nPageOfs   = nOfs;
+  nOfs += sHdr.nPageCnt * sizeof(gslc_tsLayoutPage);
+  sHdr.nStyleOfs  = GSLC_LAYOUT_ALIGN(nOfs);
+  nOfs = sHdr.nStyleOfs + sHdr.nStyleCnt * (sizeof(gslc_tsStyle) + sizeof(int16_t));
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pCollect = &pGui->asPage[nPageInd].sCollect;
+    nOfs = GSLC_LAYOUT_ALIGN(nOfs) + (pCollect->nElemRefCnt - pCollect->nElemRefFree) *
+      (sizeof(gslc_tsElem) + sizeof(gslc_tsLayoutElem));
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+        continue;
+      }
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      if (!gslc_LayoutElemFix(pGui,pElem,asCb,nCbCnt,&sFix,&nStrLen)) {
+        return false;
+      }
+    }
+  }
+  sHdr.nStrOfs    = nOfs;
+  sHdr.nSize      = nOfs + nStrLen;
+
+  FILE* pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutSave() can't create file [%s]\n",pFname);
+    return false;
+  }
+
+  // Header and page records
+  nOfs = 0;
+  bool bOk = gslc_LayoutWrite(pFile,&sHdr,sizeof(sHdr),&nOfs);
+  uint32_t nElemOfs = sHdr.nStyleOfs + sHdr.nStyleCnt * (sizeof(gslc_tsStyle) + sizeof(int16_t));
+  for (nPageInd=0;bOk && (nPageInd<pGui->nPageCnt);nPageInd++) {
+    pCollect = &pGui->asPage[nPageInd].sCollect;
+    sPage.nPageId   = pGui->asPage[nPageInd].nPageId;
+    sPage.nElemCnt  = pCollect->nElemRefCnt - pCollect->nElemRefFree;
+    sPage.nElemOfs  = GSLC_LAYOUT_ALIGN(nElemOfs);
+    sPage.nFixOfs   = sPage.nElemOfs + sPage.nElemCnt * sizeof(gslc_tsElem);
+    nElemOfs        = sPage.nFixOfs + sPage.nElemCnt * sizeof(gslc_tsLayoutElem);
+    bOk = gslc_LayoutWrite(pFile,&sPage,sizeof(sPage),&nOfs);
+  }
+
+  // Style records, followed by their font IDs
+  bOk = bOk && gslc_LayoutPad(pFile,sHdr.nStyleOfs,&nOfs);
+  for (nInd=0;bOk && (nInd<sHdr.nStyleCnt);nInd++) {
+    gslc_tsStyle sStyle = *gslc_StyleGet(pGui,(uint8_t)nInd);
+    sStyle.pTxtFont = NULL;
+    bOk = gslc_LayoutWrite(pFile,&sStyle,sizeof(sStyle),&nOfs);
+  }
+  for (nInd=0;bOk && (nInd<sHdr.nStyleCnt);nInd++) {
+    const gslc_tsFont* pFont = gslc_StyleGet(pGui,(uint8_t)nInd)->pTxtFont;
+    int16_t nFontId = (pFont == NULL)? GSLC_FONT_NONE : pFont->nId;
+    bOk = gslc_LayoutWrite(pFile,&nFontId,sizeof(nFontId),&nOfs);
+  }
+
+  // Element records (with their pointers cleared), followed by their fixup records
+  nStrLen = 0;
+  for (nPageInd=0;bOk && (nPageInd<pGui->nPageCnt);nPageInd++) {
+    pCollect = &pGui->asPage[nPageInd].sCollect;
+    bOk = gslc_LayoutPad(pFile,GSLC_LAYOUT_ALIGN(nOfs),&nOfs);
+    for (nInd=0;bOk && (nInd<pCollect->nElemRefCnt);nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+        continue;
+      }
+      sElem = *gslc_GetElemFromRef(pGui,pElemRef);
+#if !((GSLC_LOCAL_STR) && !(GSLC_STR_ARENA))
+      if (sElem.pStrBuf != NULL) {
+        // The text is restored into the string table, which is writable
+        // in the loaded layout's private mapping
+        sElem.eTxtFlags = (gslc_teTxtFlags)((sElem.eTxtFlags & ~(GSLC_TXT_MEM | GSLC_TXT_ALLOC)) |
+          GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT);
+      }
+      sElem.pStrBuf         = NULL;
+#endif
+#if (GSLC_FEATURE_COMPACT_ELEM)
+      sElem.pImgRef         = NULL;
+      sElem.nCbOvr          = GSLC_ELEM_CB_NONE;
+#else
+      sElem.sImgRefNorm     = gslc_ResetImage();
+      sElem.sImgRefGlow     = gslc_ResetImage();
+      sElem.pTxtFont        = NULL;
+      sElem.pfuncXDraw      = NULL;
+      sElem.pfuncXTouch     = NULL;
+      sElem.pfuncXTick      = NULL;
+#endif
+      bOk = gslc_LayoutWrite(pFile,&sElem,sizeof(sElem),&nOfs);
+    }
+    for (nInd=0;bOk && (nInd<pCollect->nElemRefCnt);nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+        continue;
+      }
+      gslc_LayoutElemFix(pGui,gslc_GetElemFromRef(pGui,pElemRef),asCb,nCbCnt,&sFix,&nStrLen);
+      sFix.eElemFlags = (uint8_t)pElemRef->eElemFlags;
+      bOk = gslc_LayoutWrite(pFile,&sFix,sizeof(sFix),&nOfs);
+    }
+  }
+
+  // String table, in the same order as the offsets were allocated
+  for (nPageInd=0;bOk && (nPageInd<pGui->nPageCnt);nPageInd++) {
+    pCollect = &pGui->asPage[nPageInd].sCollect;
+    for (nInd=0;bOk && (nInd<pCollect->nElemRefCnt);nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+        continue;
+      }
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+#if !((GSLC_LOCAL_STR) && !(GSLC_STR_ARENA))
+      if (pElem->pStrBuf != NULL) {
+        uint32_t nOfsStr = nOfs;
+        bOk = gslc_LayoutWrite(pFile,pElem->pStrBuf,strlen(pElem->pStrBuf)+1,&nOfs);
+        bOk = bOk && gslc_LayoutPad(pFile,nOfsStr + pElem->nStrBufMax,&nOfs);
+      }
+#endif
+      if (bOk && ((GSLC_ELEM_IMG_NORM(pElem).eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_NONE)) {
+        bOk = gslc_LayoutWrite(pFile,GSLC_ELEM_IMG_NORM(pElem).pFname,strlen(GSLC_ELEM_IMG_NORM(pElem).pFname)+1,&nOfs);
+      }
+      if (bOk && ((GSLC_ELEM_IMG_GLOW(pElem).eImgFlags & GSLC_IMGREF_SRC) != GSLC_IMGREF_NONE)) {
+        bOk = gslc_LayoutWrite(pFile,GSLC_ELEM_IMG_GLOW(pElem).pFname,strlen(GSLC_ELEM_IMG_GLOW(pElem).pFname)+1,&nOfs);
+      }
+    }
+  }
+
+  if (fclose(pFile) != 0) {
+    bOk = false;
+  }
+  if (!bOk) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutSave() write to file [%s] failed\n",pFname);
+    return false;
+  }
+  return true;
 }
 
-// Check the redraw flag on all elements on the current page and update
-// the redraw status if additional redraws are required (or the
-// entire page should be marked as requiring redraw).
-// - The typical case for this being required is when an element
-//   requires redraw but it is marked as being transparent. Therefore,
-//   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
-void gslc_PageRedrawCalc(gslc_tsGui* pGui)
+// Restore the pointers of an element record from its fixup record
+static bool gslc_LayoutElemLoad(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsLayoutElem* pFix,
+  char* pStrTbl,uint32_t nStrLen,const gslc_tsElemType* asCb,uint8_t nCbCnt)
 {
-  int               nInd;
-  int               nStackPage;
-  gslc_tsElem*      pElem = NULL;
-  gslc_tsElemRef*   pElemRef = NULL;
-  gslc_tsCollect*   pCollect = NULL;
+  uint8_t nInd;
 
-  bool  bRedrawFullPage = false;  // Does entire page require redraw?
-  gslc_tsPage*  pPage = NULL;
+  // Clear the pointers stored in the file before any are restored
+  // so that a partially loaded element can be released safely
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  pElem->pImgRef        = NULL;
+#else
+  pElem->sImgRefNorm    = gslc_ResetImage();
+  pElem->sImgRefGlow    = gslc_ResetImage();
+  pElem->pTxtFont       = NULL;
+#endif
 
-  // Work on each enabled page in the stack
-  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
-    // Select the page collection to process
-    pPage = pGui->apPageStack[nStackPage];
-    if (!pPage) {
-      // If this stack page is not enabled, skip to next stack page
+  // Extended and compound elements are never saved
+  if ((pElem->pXData != NULL) || (pElem->pElemRefParent != NULL)) {
+    return false;
+  }
+
+  // Text is referenced in the string table
+  // - The element's whole string buffer must lie within the table
+#if !((GSLC_LOCAL_STR) && !(GSLC_STR_ARENA))
+  pElem->pStrBuf = NULL;
+  if (pFix->nStrOfs != GSLC_LAYOUT_NONE) {
+    if ((pFix->nStrOfs >= nStrLen) || (pElem->nStrBufMax > nStrLen - pFix->nStrOfs)) {
+      return false;
+    }
+    pElem->pStrBuf = pStrTbl + pFix->nStrOfs;
+  }
+#else
+  // Text is stored within the element
+  // - The string buffer must fit within the element and be terminated
+  if ((pElem->nStrBufMax > GSLC_LOCAL_STR_LEN) ||
+      (memchr(pElem->pStrBuf,'\0',GSLC_LOCAL_STR_LEN) == NULL)) {
+    return false;
+  }
+#endif
+
+#if !(GSLC_FEATURE_COMPACT_ELEM)
+  if (pFix->nFontId != GSLC_FONT_NONE) {
+    pElem->pTxtFont = gslc_FontGet(pGui,pFix->nFontId);
+    if (pElem->pTxtFont == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutLoad() font (ID=%d) was not found\n",pFix->nFontId);
+      return false;
+    }
+  }
+#endif
+
+  for (nInd=0;nInd<2;nInd++) {
+    if (pFix->anImgOfs[nInd] == GSLC_LAYOUT_NONE) {
       continue;
     }
-    if (!pGui->abPageStackDoDraw[nStackPage]) {
-      // If this stack page has redraw disabled, skip full-page redraw check
+    if ((pFix->anImgOfs[nInd] >= nStrLen) || (!gslc_ElemImgRefAlloc(pGui,pElem))) {
+      return false;
+    }
+    gslc_tsImgRef sImgRef = gslc_GetImageFromFile(pStrTbl + pFix->anImgOfs[nInd],
+      (gslc_teImgRefFlags)pFix->aeImgFlags[nInd]);
+    if (nInd == 0) {
+      gslc_DrvSetElemImageNorm(pGui,pElem,sImgRef);
+    } else {
+      gslc_DrvSetElemImageGlow(pGui,pElem,sImgRef);
+    }
+  }
+
+  gslc_tsElemType sCb = {GSLC_TYPE_NONE,NULL,NULL,NULL};
+  for (nInd=0;nInd<3;nInd++) {
+    if (pFix->anCb[nInd] == 0) {
       continue;
     }
-    pCollect = &pPage->sCollect;
+    if (pFix->anCb[nInd] > nCbCnt) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutLoad() callback (%u) not in callback table\n",pFix->anCb[nInd]);
+      return false;
+    }
+    gslc_LayoutCbCopy(&sCb,&asCb[pFix->anCb[nInd]-1],nInd);
+  }
+  return gslc_ElemCbOvrSet(pGui,pElem,&sCb);
+}
 
-    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
-      pElemRef = &pCollect->asElemRef[nInd];
-      gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
-      pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      //GSLC_DEBUG_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
-      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
-      if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+// Release the resources restored by gslc_LayoutElemLoad()
+// - The first nElemCnt elements (across pages) are released
+static void gslc_LayoutElemUnload(gslc_tsGui* pGui,uint8_t* pMap,const gslc_tsLayoutPage* asPage,
+  uint16_t nPageCnt,uint32_t nElemCnt)
+{
+  gslc_tsElem*  asElem;
+  uint16_t      nPageInd,nInd;
 
-        // If partial redraw is supported, then we
-        // look out for transparent elements which may
-        // still warrant full page redraw.
-        if (pGui->bRedrawPartialEn) {
-          // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
-          if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
-            bRedrawFullPage = true;
-          }
-        } else {
-          bRedrawFullPage = true;
-        }
+  for (nPageInd=0;(nPageInd<nPageCnt) && (nElemCnt > 0);nPageInd++) {
+    asElem  = (gslc_tsElem*)(pMap + asPage[nPageInd].nElemOfs);
+    for (nInd=0;(nInd<asPage[nPageInd].nElemCnt) && (nElemCnt > 0);nInd++,nElemCnt--) {
+      gslc_ElemDestruct(&asElem[nInd]);
+      gslc_ElemImgRefFree(pGui,&asElem[nInd]);
+    }
+  }
+}
 
-        if (bRedrawFullPage) {
-          // Determined that full page needs redraw
-          // so no need to check any more elements
-          break;
-        }
+bool gslc_LayoutLoad(gslc_tsGui* pGui,gslc_tsLayout* pLayout,const char* pFname,
+        const gslc_tsElemType* asCb,uint8_t nCbCnt)
+{
+  if ((pGui == NULL) || (pLayout == NULL) || (pFname == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "LayoutLoad";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  pLayout->pvMap  = NULL;
+  pLayout->nSize  = 0;
+
+  int nFd = open(pFname,O_RDONLY);
+  if (nFd < 0) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() can't open file [%s]\n",pFname);
+    return false;
+  }
+  struct stat sStat;
+  if ((fstat(nFd,&sStat) != 0) || (sStat.st_size < (off_t)sizeof(gslc_tsLayoutHdr))) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() invalid file [%s]\n",pFname);
+    close(nFd);
+    return false;
+  }
+  // Map the file privately so that the elements can be updated in place
+  void* pvMap = mmap(NULL,(size_t)sStat.st_size,PROT_READ | PROT_WRITE,MAP_PRIVATE,nFd,0);
+  close(nFd);
+  if (pvMap == MAP_FAILED) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() can't map file [%s]\n",pFname);
+    return false;
+  }
+  pLayout->pvMap  = pvMap;
+  pLayout->nSize  = (uint32_t)sStat.st_size;
+
+  uint8_t*                  pMap    = (uint8_t*)pvMap;
+  const gslc_tsLayoutHdr*   pHdr    = (const gslc_tsLayoutHdr*)pMap;
+  const gslc_tsLayoutPage*  asPage  = (const gslc_tsLayoutPage*)(pMap + pHdr->nPageOfs);
+  const gslc_tsLayoutPage*  pPage;
+  gslc_tsPage*              pPageCur;
+  gslc_tsElem*              asElem;
+  const gslc_tsLayoutElem*  asFix;
+  gslc_tsStyle*             asStyle = (gslc_tsStyle*)(pMap + pHdr->nStyleOfs);
+  uint32_t                  nElemLoaded = 0;
+  uint16_t                  nPageInd,nInd;
+
+  // The element and style records must match the layout of this build
+  if ((pHdr->nMagic != GSLC_LAYOUT_MAGIC) || (pHdr->nVersion != GSLC_LAYOUT_VERSION) ||
+      (pHdr->nSize != pLayout->nSize) || (pHdr->nStrOfs > pHdr->nSize) ||
+      (pHdr->nPageOfs + pHdr->nPageCnt * sizeof(gslc_tsLayoutPage) > pHdr->nStrOfs) ||
+      (pHdr->nStyleOfs + pHdr->nStyleCnt * (sizeof(gslc_tsStyle) + sizeof(int16_t)) > pHdr->nStrOfs)) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() invalid file [%s]\n",pFname);
+    gslc_LayoutUnload(pGui,pLayout);
+    return false;
+  }
+  if ((pHdr->nElemSize != sizeof(gslc_tsElem)) || (pHdr->nStyleSize != sizeof(gslc_tsStyle)) ||
+      (pHdr->nPtrSize != sizeof(void*)) || (pHdr->nFlags != gslc_LayoutFlags())) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() file [%s] doesn't match the element layout\n",pFname);
+    gslc_LayoutUnload(pGui,pLayout);
+    return false;
+  }
+  // Strings must be terminated within the string table
+  char*     pStrTbl = (char*)(pMap + pHdr->nStrOfs);
+  uint32_t  nStrLen = pHdr->nSize - pHdr->nStrOfs;
+  if ((nStrLen > 0) && (pStrTbl[nStrLen-1] != '\0')) {
+    GSLC_DEBUG_PRINT("ERROR: LayoutLoad() invalid file [%s]\n",pFname);
+    gslc_LayoutUnload(pGui,pLayout);
+    return false;
+  }
+
+  // Check that the pages exist and have room for the elements
+  for (nPageInd=0;nPageInd<pHdr->nPageCnt;nPageInd++) {
+    pPage = &asPage[nPageInd];
+    if ((pPage->nElemOfs & 7) || (pPage->nElemOfs + pPage->nElemCnt * sizeof(gslc_tsElem) > pPage->nFixOfs) ||
+        (pPage->nFixOfs + pPage->nElemCnt * sizeof(gslc_tsLayoutElem) > pHdr->nStrOfs)) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutLoad() invalid file [%s]\n",pFname);
+      gslc_LayoutUnload(pGui,pLayout);
+      return false;
+    }
+    pPageCur = (pPage->nPageId == GSLC_PAGE_NONE)? NULL : gslc_PageFindById(pGui,pPage->nPageId);
+    if (pPageCur == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutLoad() page (ID=%d) was not found\n",pPage->nPageId);
+      gslc_LayoutUnload(pGui,pLayout);
+      return false;
+    }
+    if (pPageCur->sCollect.nElemRefMax - pPageCur->sCollect.nElemRefCnt + pPageCur->sCollect.nElemRefFree <
+        pPage->nElemCnt) {
+      GSLC_DEBUG_PRINT("ERROR: LayoutLoad() too many element references on page (ID=%d)\n",pPage->nPageId);
+      gslc_LayoutUnload(pGui,pLayout);
+      return false;
+    }
+  }
 
+  // Restore the style fonts
+  // - The style table is only adopted once all elements have loaded
+  if (pHdr->nStyleCnt > 0) {
+    const int16_t*  anFontId  = (const int16_t*)(asStyle + pHdr->nStyleCnt);
+    for (nInd=0;nInd<pHdr->nStyleCnt;nInd++) {
+      asStyle[nInd].pTxtFont = NULL;
+      if (anFontId[nInd] == GSLC_FONT_NONE) {
+        continue;
+      }
+      asStyle[nInd].pTxtFont = gslc_FontGet(pGui,anFontId[nInd]);
+      if (asStyle[nInd].pTxtFont == NULL) {
+        GSLC_DEBUG_PRINT("ERROR: LayoutLoad() font (ID=%d) was not found\n",anFontId[nInd]);
+        gslc_LayoutUnload(pGui,pLayout);
+        return false;
       }
     }
+  }
 
-  } // nStackPage
+  // Restore the element pointers
+  // - On failure, release what the loaded elements (including a
+  //   partially loaded one) have allocated before unmapping
+  bool bOk = true;
+  for (nPageInd=0;bOk && (nPageInd<pHdr->nPageCnt);nPageInd++) {
+    pPage   = &asPage[nPageInd];
+    asElem  = (gslc_tsElem*)(pMap + pPage->nElemOfs);
+    asFix   = (const gslc_tsLayoutElem*)(pMap + pPage->nFixOfs);
+    for (nInd=0;bOk && (nInd<pPage->nElemCnt);nInd++) {
+      nElemLoaded++;
+      if (!gslc_LayoutElemLoad(pGui,&asElem[nInd],&asFix[nInd],pStrTbl,nStrLen,asCb,nCbCnt)) {
+        GSLC_DEBUG_PRINT("ERROR: LayoutLoad() can't load element (ID=%d)\n",asElem[nInd].nId);
+        bOk = false;
+      }
+    }
+  }
 
-  if (bRedrawFullPage) {
-    // Mark the entire screen as requiring redraw
-    gslc_PageRedrawSet(pGui,true);
+  // Adopt the style table
+  if (bOk && (pHdr->nStyleCnt > 0)) {
+    gslc_SetStyleTable(pGui,asStyle,(uint8_t)pHdr->nStyleCnt);
+    bOk = (pGui->asStyleConst == asStyle);
+  }
+  if (!bOk) {
+    gslc_LayoutElemUnload(pGui,pMap,asPage,pHdr->nPageCnt,nElemLoaded);
+    gslc_LayoutUnload(pGui,pLayout);
+    return false;
   }
 
+  // Reference the elements in place
+  for (nPageInd=0;nPageInd<pHdr->nPageCnt;nPageInd++) {
+    pPage   = &asPage[nPageInd];
+    asElem  = (gslc_tsElem*)(pMap + pPage->nElemOfs);
+    asFix   = (const gslc_tsLayoutElem*)(pMap + pPage->nFixOfs);
+    for (nInd=0;nInd<pPage->nElemCnt;nInd++) {
+      gslc_ElemAdd(pGui,pPage->nPageId,&asElem[nInd],(gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST |
+        (asFix[nInd].eElemFlags & (GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_STATIC)) | GSLC_ELEMREF_REDRAW_FULL));
+    }
+  }
+  return true;
 }
 
-// Redraw the active page
-// - If the page has been marked as needing redraw, then all
-//   elements are rendered
-// - If the page has not been marked as needing redraw then only
-//   the elements that have been marked as needing redraw
-//   are rendered.
-void gslc_PageRedrawGo(gslc_tsGui* pGui)
+void gslc_LayoutUnload(gslc_tsGui* pGui,gslc_tsLayout* pLayout)
 {
-  // Update any page redraw status that may be required
-  // - Note that this routine handles cases where an element
-  //   marked as requiring update is semi-transparent which can
-  //   cause other elements to be redrawn as well.
-  gslc_PageRedrawCalc(pGui);
+  if (pLayout == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "LayoutUnload";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (pLayout->pvMap != NULL) {
+    munmap(pLayout->pvMap,pLayout->nSize);
+  }
+  pLayout->pvMap  = NULL;
+  pLayout->nSize  = 0;
+}
+#endif // GSLC_FEATURE_LAYOUT
 
-  // Determine final state of full-page redraw
-  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
+void gslc_SetElemPool(gslc_tsGui* pGui,gslc_tsElem* asElem,uint16_t nElemMax)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetElemPool";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (pGui->nElemPoolCnt > 0) {
+    GSLC_DEBUG_PRINT("ERROR: SetElemPool(%s) called after pool elements were added\n","");
+    return;
+  }
+  pGui->asElemPool      = asElem;
+  pGui->nElemPoolMax    = (asElem == NULL)? 0 : nElemMax;
+  pGui->nElemPoolCnt    = 0;
+  pGui->nElemPoolFree   = GSLC_IND_NONE;
+}
 
-  // If a full page redraw is required, then start by
-  // redrawing the background.
-  // NOTE:
-  // - It would be cleaner if we could treat the background
-  //   layer like any other element (and hence check for its
-  //   need-redraw status).
-  // - For now, assume background doesn't need update except
-  //   if the entire page is to be redrawn
-  //   TODO: Fix this assumption (either add specific flag
-  //         for bBkgndNeedRedraw or make the background just
-  //         another element).
-  if (bPageRedraw) {
-    gslc_DrvDrawBkgnd(pGui);
-    gslc_PageFlipSet(pGui,true);
+void gslc_SetXDataArena(gslc_tsGui* pGui,void* pvArena,uint32_t nArenaSize)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetXDataArena";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (pGui->nXDataArenaUsed > 0) {
+    GSLC_DEBUG_PRINT("ERROR: SetXDataArena(%s) called after allocations were made\n","");
+    return;
+  }
+  pGui->pXDataArena     = (uint8_t*)pvArena;
+  pGui->nXDataArenaSize = (pvArena == NULL)? 0 : nArenaSize;
+  pGui->nXDataArenaUsed = 0;
+  pGui->nXDataArenaPeak = 0;
+}
+
+void* gslc_XDataArenaAlloc(gslc_tsGui* pGui,int16_t nPage,uint32_t nSize)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "XDataArenaAlloc";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  // Align each allocation for pointer (and at least 32-bit) members
+  const uint32_t  nAlign  = (sizeof(void*) > 4)? sizeof(void*) : 4;
+  uint32_t        nOffset = (pGui->nXDataArenaUsed + nAlign-1) & ~(nAlign-1);
+  if ((nOffset > pGui->nXDataArenaSize) || (nSize > pGui->nXDataArenaSize - nOffset)) {
+    GSLC_DEBUG_PRINT("ERROR: XDataArenaAlloc() arena full (size=%u) for %u bytes\n",
+      (unsigned)pGui->nXDataArenaSize,(unsigned)nSize);
+    return NULL;
+  }
+
+  // Record the arena level before the page's first allocation
+  // so that the page's allocations can be released together
+  if (nPage != GSLC_PAGE_NONE) {
+    gslc_tsPage* pPage = gslc_PageFindById(pGui,nPage);
+    if ((pPage != NULL) && (pPage->nXDataMark == GSLC_XDATA_MARK_NONE)) {
+      pPage->nXDataMark = pGui->nXDataArenaUsed;
+    }
+  }
+
+  pGui->nXDataArenaUsed = nOffset + nSize;
+  if (pGui->nXDataArenaUsed > pGui->nXDataArenaPeak) {
+    pGui->nXDataArenaPeak = pGui->nXDataArenaUsed;
+  }
+  memset(&pGui->pXDataArena[nOffset],0,nSize);
+  return (void*)&pGui->pXDataArena[nOffset];
+}
+
+void gslc_XDataArenaGetUsage(gslc_tsGui* pGui,uint32_t* pnUsed,uint32_t* pnPeak)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "XDataArenaGetUsage";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (pnUsed != NULL) { *pnUsed = pGui->nXDataArenaUsed; }
+  if (pnPeak != NULL) { *pnPeak = pGui->nXDataArenaPeak; }
+}
+
+int gslc_GetPageCur(gslc_tsGui* pGui)
+{
+  gslc_tsPage* pStackPage = pGui->apPageStack[GSLC_STACK_CUR];
+  if (pStackPage == NULL) {
+    return GSLC_PAGE_NONE;
+  }
+  return pStackPage->nPageId;
+}
+
+void gslc_SetStackPage(gslc_tsGui* pGui, uint8_t nStackPos, int16_t nPageId)
+{
+  int16_t nPageSaved = GSLC_PAGE_NONE;
+  gslc_tsPage* pStackPage = pGui->apPageStack[nStackPos];
+  if (pStackPage != NULL) {
+    nPageSaved = pStackPage->nPageId;
+  }
+
+  gslc_tsPage* pPage = NULL;
+  if (nPageId == GSLC_PAGE_NONE) {
+    // Disable the page
+    #if defined(DEBUG_LOG)
+    GSLC_DEBUG_PRINT("INFO: Disabled PageStack[%u]\n",nStackPos);
+    #endif
+    pPage = NULL;
+  } else {
+
+    // Find the page
+    pPage = gslc_PageFindById(pGui, nPageId);
+    if (pPage == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: SetStackPage() can't find page (ID=%d)\n", nPageId);
+      return;
+    }
+  }
+
+  // Save a reference to the selected page
+  pGui->apPageStack[nStackPos] = pPage;
+
+  #if defined(DEBUG_LOG)
+  GSLC_DEBUG_PRINT("INFO: Changed PageStack[%u] to page %u\n",nStackPos,nPageId);
+  #endif
+
+  // A change of page should always force a future redraw
+  if (nPageSaved != nPageId) {
+    gslc_PageRedrawSet(pGui,true);
+  }
+}
+
+
+void gslc_SetStackState(gslc_tsGui* pGui, uint8_t nStackPos, bool bActive, bool bDoDraw)
+{
+  gslc_tsPage* pStackPage = pGui->apPageStack[nStackPos];
+  if (pStackPage == NULL) {
+    // TODO: Error
+    return;
+  }
+  pGui->abPageStackActive[nStackPos] = bActive;
+  pGui->abPageStackDoDraw[nStackPos] = bDoDraw;
+}
+
+void gslc_SetPageBase(gslc_tsGui* pGui, int16_t nPageId)
+{
+  gslc_SetStackPage(pGui, GSLC_STACK_BASE, nPageId);
+}
+
+void gslc_SetPageCur(gslc_tsGui* pGui,int16_t nPageId)
+{
+  gslc_SetStackPage(pGui, GSLC_STACK_CUR, nPageId);
+}
+
+void gslc_SetPageOverlay(gslc_tsGui* pGui,int16_t nPageId)
+{
+  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
+}
+
+// Release any display region saved under the current popup
+// - Called when the saved region no longer matches the state
+//   of the underlying pages (eg. after they have been redrawn)
+void gslc_PopupSaveDiscard(gslc_tsGui* pGui)
+{
+  if (!pGui->bPopupSaveValid) {
+    return;
+  }
+  pGui->bPopupSaveValid = false;
+#if (DRV_HAS_DRAW_RECT_SAVE)
+  gslc_DrvDiscardRect(pGui);
+#endif
+}
+
+// Save the display region under a popup page
+// - Any pending redraw of the underlying pages is completed
+//   first so that the saved region is up to date
+bool gslc_PopupSave(gslc_tsGui* pGui, int16_t nPageId)
+{
+  gslc_PopupSaveDiscard(pGui);
+#if (DRV_HAS_DRAW_RECT_SAVE)
+  if ((!pGui->bPopupSaveUnderEn) || (!pGui->bRedrawPartialEn)) {
+    return false;
+  }
+  gslc_tsPage* pPage = gslc_PageFindById(pGui, nPageId);
+  if (pPage == NULL) {
+    return false;
+  }
+
+  // Determine the region covered by the popup's elements
+  gslc_tsCollect* pCollect = &pPage->sCollect;
+  gslc_tsElemRef* pElemRef = NULL;
+  gslc_tsRect     rSave = (gslc_tsRect){0,0,0,0};
+  uint16_t        nInd;
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElemRef = &pCollect->asElemRef[nInd];
+    if (gslc_ElemGetVisible(pGui,pElemRef)) {
+      gslc_UnionRect(&rSave,gslc_GetElemFromRef(pGui,pElemRef)->rElem);
+    }
+  }
+  if ((rSave.w == 0) || (rSave.h == 0)) {
+    return false;
+  }
+
+  gslc_PageRedrawGo(pGui);
+  if (!gslc_DrvSaveRect(pGui,rSave)) {
+    return false;
+  }
+  pGui->bPopupSaveValid = true;
+  pGui->rPopupSave      = rSave;
+  return true;
+#else
+  (void)nPageId; // Unused
+  return false;
+#endif
+}
+
+void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
+{
+  // Save the display region that will be covered by the popup
+  // - Any pending redraw has been completed before the save
+  bool bSaved = gslc_PopupSave(pGui, nPageId);
+
+  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
+  if (bSaved) {
+    // The underlying pages are already up to date on the display,
+    // so only the popup's elements need to be drawn
+    gslc_PageRedrawSet(pGui, false);
+    gslc_tsCollect* pCollect = &pGui->apPageStack[GSLC_STACK_OVERLAY]->sCollect;
+    uint16_t        nInd;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      if (pCollect->asElemRef[nInd].eElemFlags == GSLC_ELEMREF_NONE) {
+        continue;
+      }
+      gslc_ElemSetRedraw(pGui,&pCollect->asElemRef[nInd],GSLC_REDRAW_FULL);
+    }
+  }
+  // If modal dialog selected, then deactivate other pages in stack
+  // If modeless dialog selected, then don't deactivate other pages in stack
+  if (bModal) {
+    // Modal: deactive other pages and disable redraw
+    gslc_SetStackState(pGui, GSLC_STACK_CUR, false, false);
+    gslc_SetStackState(pGui, GSLC_STACK_BASE, false, false);
+  }
+  else {
+    // Modeless: activate other pages but disable redraw
+    gslc_SetStackState(pGui, GSLC_STACK_CUR, true, false);
+    gslc_SetStackState(pGui, GSLC_STACK_BASE, true, false);
+  }
+}
+
+void gslc_PopupHide(gslc_tsGui* pGui)
+{
+  // Note any full page redraw that was already pending (no redraw
+  // occurs before the saved region is restored below)
+  bool bRedrawPending = gslc_PageRedrawGet(pGui);
+
+  gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
+  // Ensure other pages in stack are activated
+  // - This is done in case they were deactivated due to a modal popup
+  gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
+  gslc_SetStackState(pGui, GSLC_STACK_BASE, true, true);
+
+  // Restore the display region saved under the popup instead
+  // of redrawing the underlying pages
+  // - Any underlying elements that changed while the popup was shown
+  //   are still marked for redraw (since drawing of their pages was
+  //   disabled) and will be redrawn during the next update
+#if (DRV_HAS_DRAW_RECT_SAVE)
+  if (pGui->bPopupSaveValid) {
+    pGui->bPopupSaveValid = false;
+    if (gslc_DrvRestoreRect(pGui)) {
+      gslc_PageRedrawSet(pGui, bRedrawPending);
+      gslc_PageFlipSet(pGui, true);
+    }
+  }
+#else
+  (void)bRedrawPending; // Unused
+#endif
+}
+
+void gslc_PopupSetSaveUnder(gslc_tsGui* pGui,bool bSaveUnder)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "PopupSetSaveUnder";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->bPopupSaveUnderEn = bSaveUnder;
+  if (!bSaveUnder) {
+    gslc_PopupSaveDiscard(pGui);
+  }
+}
+
+void gslc_PageSetStaticLayer(gslc_tsGui* pGui,int16_t nPageId,bool bEn)
+{
+  gslc_tsPage* pPage = gslc_PageFindById(pGui, nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: PageSetStaticLayer() can't find page (ID=%d)\n", nPageId);
+    return;
+  }
+  pPage->bStaticLayerEn     = bEn;
+  pPage->bStaticLayerValid  = false;
+#if (DRV_HAS_DRAW_LAYER)
+  if (!bEn) {
+    gslc_DrvLayerDestroy(pGui,&pPage->pvStaticLayer);
+  }
+#endif
+}
+
+void gslc_PageStaticLayerReset(gslc_tsGui* pGui)
+{
+  uint8_t nPageInd;
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pGui->asPage[nPageInd].bStaticLayerValid = false;
+  }
+}
+
+gslc_tsPage* gslc_PageStaticLayerGet(gslc_tsGui* pGui)
+{
+  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_CUR];
+  if ((pPage == NULL) || (!pPage->bStaticLayerValid)) {
+    return NULL;
+  }
+  // The layer includes the static elements of the base page, so
+  // it is only valid for the base page that it was built with
+  gslc_tsPage* pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  int16_t nPageBase = (pPageBase)?pPageBase->nPageId:GSLC_PAGE_NONE;
+  if (nPageBase != pPage->nStaticLayerBase) {
+    return NULL;
+  }
+  return pPage;
+}
+
+bool gslc_PagePrerender(gslc_tsGui* pGui,int16_t nPageId)
+{
+#if (DRV_HAS_DRAW_LAYER)
+  gslc_tsPage* pPage = gslc_PageFindById(pGui, nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: PagePrerender() can't find page (ID=%d)\n", nPageId);
+    return false;
+  }
+  if ((pGui->nPrerenderMax == 0) || (pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL)) {
+    return false;
+  }
+
+  // Complete any pending redraw so that the elements shared with
+  // the display (ie. on the base page) are up to date
+  gslc_PageRedrawGo(pGui);
+
+  gslc_tsPage* pPageCur = pGui->apPageStack[GSLC_STACK_CUR];
+  gslc_tsPage* pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  int16_t nPageBase = (pPageBase)?pPageBase->nPageId:GSLC_PAGE_NONE;
+  if ((pPage->bPrerenderValid) && (pPage->nPrerenderBase == nPageBase)) {
+    return true;
+  }
+
+  // Make room within the budget
+  gslc_PagePrerenderEvict(pGui,pPage,pGui->nPrerenderMax-1);
+
+  if (pPage == pPageCur) {
+    // The page is already on the display
+    pPage->bPrerenderValid = gslc_DrvLayerSave(pGui,&pPage->pvPrerender);
+  } else {
+    // Save the display, render the page in its place as the current
+    // page and capture it, then restore the display. The display is
+    // not flipped in between.
+    void* pvDisp = NULL;
+    if (!gslc_DrvLayerSave(pGui,&pvDisp)) {
+      return false;
+    }
+    pGui->apPageStack[GSLC_STACK_CUR] = pPage;
+
+    gslc_tsPage*    apPage[2] = { pPageBase, pPage };
+    gslc_tsCollect* pCollect = NULL;
+    gslc_tsElemRef* pElemRef = NULL;
+    uint16_t        nInd;
+    uint8_t         nPageInd;
+    bool            bStaticDrawn = gslc_PageStaticLayerDraw(pGui);
+    if (!bStaticDrawn) {
+      gslc_DrvDrawBkgnd(pGui);
+    }
+    for (nPageInd=0;nPageInd<2;nPageInd++) {
+      if (apPage[nPageInd] == NULL) {
+        continue;
+      }
+      pCollect = &apPage[nPageInd]->sCollect;
+      for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+        pElemRef = &pCollect->asElemRef[nInd];
+        if ((bStaticDrawn) && (gslc_ElemGetStatic(pGui,pElemRef))) {
+          continue;
+        }
+        gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
+      }
+    }
+    pPage->bPrerenderValid = gslc_DrvLayerSave(pGui,&pPage->pvPrerender);
+
+    pGui->apPageStack[GSLC_STACK_CUR] = pPageCur;
+    gslc_tsRect rDisp = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+    gslc_DrvLayerRestore(pGui,pvDisp,rDisp);
+    gslc_DrvLayerDestroy(pGui,&pvDisp);
+  }
+  pPage->nPrerenderBase = nPageBase;
+  pPage->nPrerenderSeq  = ++pGui->nPrerenderSeq;
+  return pPage->bPrerenderValid;
+#else
+  (void)pGui; // Unused
+  (void)nPageId; // Unused
+  return false;
+#endif
+}
+
+void gslc_SetPrerenderMax(gslc_tsGui* pGui,uint8_t nMax)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetPrerenderMax";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->nPrerenderMax = nMax;
+  gslc_PagePrerenderEvict(pGui,NULL,nMax);
+}
+
+void gslc_PagePrerenderEvict(gslc_tsGui* pGui,gslc_tsPage* pPageKeep,uint8_t nMax)
+{
+#if (DRV_HAS_DRAW_LAYER)
+  uint8_t       nPageInd;
+  uint8_t       nCnt;
+  gslc_tsPage*  pPage = NULL;
+  gslc_tsPage*  pPageOld = NULL;
+  while (1) {
+    // Count the pre-rendered pages and find the least recently used
+    // - Out of date pages are released first
+    nCnt = 0;
+    pPageOld = NULL;
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      pPage = &pGui->asPage[nPageInd];
+      if ((pPage == pPageKeep) || (pPage->pvPrerender == NULL)) {
+        continue;
+      }
+      nCnt++;
+      if ((pPageOld == NULL) || (pPageOld->bPrerenderValid && !pPage->bPrerenderValid) ||
+          ((pPageOld->bPrerenderValid == pPage->bPrerenderValid) &&
+          ((int16_t)(pPage->nPrerenderSeq - pPageOld->nPrerenderSeq) < 0))) {
+        pPageOld = pPage;
+      }
+    }
+    if (nCnt <= nMax) {
+      break;
+    }
+    pPageOld->bPrerenderValid = false;
+    gslc_DrvLayerDestroy(pGui,&pPageOld->pvPrerender);
+  }
+#else
+  (void)pGui; // Unused
+  (void)pPageKeep; // Unused
+  (void)nMax; // Unused
+#endif
+}
+
+void gslc_PagePrerenderReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint8_t       nPageInd;
+  gslc_tsPage*  pPage = NULL;
+  int16_t       nPageId = GSLC_PAGE_NONE;
+  bool          bValid = false;
+
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    bValid |= pGui->asPage[nPageInd].bPrerenderValid;
+  }
+  if (!bValid) {
+    return;
+  }
+
+  // Locate the page that owns the element
+  // - Sub-elements of compound elements aren't located, but
+  //   changes to them also mark their parent element for redraw
+  if (pElemRef != NULL) {
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      pPage = &pGui->asPage[nPageInd];
+      if ((pElemRef >= pPage->sCollect.asElemRef) &&
+          (pElemRef < pPage->sCollect.asElemRef + pPage->sCollect.nElemRefCnt)) {
+        nPageId = pPage->nPageId;
+        break;
+      }
+    }
+    if (nPageId == GSLC_PAGE_NONE) {
+      return;
+    }
+  }
+
+  // Mark the pages that include the element (either directly or
+  // through their base page) as out of date
+  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+    pPage = &pGui->asPage[nPageInd];
+    if ((pElemRef == NULL) || (pPage->nPageId == nPageId) || (pPage->nPrerenderBase == nPageId)) {
+      pPage->bPrerenderValid = false;
+    }
+  }
+}
+
+bool gslc_PagePrerenderDraw(gslc_tsGui* pGui)
+{
+#if (DRV_HAS_DRAW_LAYER)
+  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_CUR];
+  if ((pPage == NULL) || (!pPage->bPrerenderValid)) {
+    return false;
+  }
+  gslc_tsPage* pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  int16_t nPageBase = (pPageBase)?pPageBase->nPageId:GSLC_PAGE_NONE;
+  if (nPageBase != pPage->nPrerenderBase) {
+    return false;
+  }
+  gslc_tsRect rDisp = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  if (!gslc_DrvLayerRestore(pGui,pPage->pvPrerender,rDisp)) {
+    return false;
+  }
+  pPage->nPrerenderSeq = ++pGui->nPrerenderSeq;
+  return true;
+#else
+  (void)pGui; // Unused
+  return false;
+#endif
+}
+
+bool gslc_PageStaticLayerDraw(gslc_tsGui* pGui)
+{
+#if (DRV_HAS_DRAW_LAYER)
+  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_CUR];
+  if ((pPage == NULL) || (!pPage->bStaticLayerEn)) {
+    return false;
+  }
+
+  // Copy the layer to the display if it is up to date
+  gslc_tsRect rDisp = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  if (gslc_PageStaticLayerGet(pGui) != NULL) {
+    if (gslc_DrvLayerRestore(pGui,pPage->pvStaticLayer,rDisp)) {
+      return true;
+    }
+  }
+
+  // Otherwise draw the background and the static elements of the
+  // base and current pages, and then capture them into the layer
+  // - If the capture fails, the static elements have still been drawn
+  gslc_tsPage*    pPageBase = pGui->apPageStack[GSLC_STACK_BASE];
+  gslc_tsPage*    apPage[2] = { pPageBase, pPage };
+  gslc_tsCollect* pCollect = NULL;
+  gslc_tsElemRef* pElemRef = NULL;
+  uint16_t        nInd;
+  uint8_t         nPageInd;
+
+  gslc_DrvDrawBkgnd(pGui);
+  for (nPageInd=0;nPageInd<2;nPageInd++) {
+    if (apPage[nPageInd] == NULL) {
+      continue;
+    }
+    pCollect = &apPage[nPageInd]->sCollect;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (gslc_ElemGetStatic(pGui,pElemRef)) {
+        gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
+      }
+    }
+  }
+  pPage->nStaticLayerBase   = (pPageBase)?pPageBase->nPageId:GSLC_PAGE_NONE;
+  pPage->bStaticLayerValid  = gslc_DrvLayerSave(pGui,&pPage->pvStaticLayer);
+  return true;
+#else
+  (void)pGui; // Unused
+  return false;
+#endif
+}
+
+
+// Adjust the flag that indicates whether the entire page
+// requires a redraw.
+void gslc_PageRedrawSet(gslc_tsGui* pGui,bool bRedraw)
+{
+  if (pGui == NULL) {
+    return;
+  }
+
+  pGui->bScreenNeedRedraw = bRedraw;
+}
+
+bool gslc_PageRedrawGet(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return false;
+  }
+
+  return pGui->bScreenNeedRedraw;
+}
+
+void gslc_InvalidateRgnAdd(gslc_tsGui* pGui,gslc_tsRect rAddRect)
+{
+  if (pGui == NULL) {
+    return;
+  }
+  if (!pGui->bInvalidateEn) {
+    pGui->rInvalidateRect = (gslc_tsRect){0,0,0,0};
+  }
+  gslc_UnionRect(&pGui->rInvalidateRect,rAddRect);
+  pGui->bInvalidateEn = (pGui->rInvalidateRect.w > 0) && (pGui->rInvalidateRect.h > 0);
+}
+
+void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return;
+  }
+  pGui->bInvalidateEn   = false;
+  pGui->rInvalidateRect = (gslc_tsRect){0,0,0,0};
+}
+
+// Check the redraw flag on all elements on the current page and update
+// the redraw status if additional redraws are required (or the
+// entire page should be marked as requiring redraw).
+// - The typical case for this being required is when an element
+//   requires redraw but it is marked as being transparent. Therefore,
+//   the lower level elements should be redrawn.
+// - For now, just mark the entire page as requiring redraw.
+// TODO: Determine which elements underneath should be redrawn based
+//       on the region exposed by the transparent element.
+void gslc_PageRedrawCalc(gslc_tsGui* pGui)
+{
+  int               nInd;
+  int               nStackPage;
+  gslc_tsElem*      pElem = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsCollect*   pCollect = NULL;
+
+  bool  bRedrawFullPage = false;  // Does entire page require redraw?
+  gslc_tsPage*  pPage = NULL;
+
+  // Work on each enabled page in the stack
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    // Select the page collection to process
+    pPage = pGui->apPageStack[nStackPage];
+    if (!pPage) {
+      // If this stack page is not enabled, skip to next stack page
+      continue;
+    }
+    if (!pGui->abPageStackDoDraw[nStackPage]) {
+      // If this stack page has redraw disabled, skip full-page redraw check
+      continue;
+    }
+    pCollect = &pPage->sCollect;
+
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      //GSLC_DEBUG_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
+      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
+      if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+
+        // If partial redraw is supported, then we
+        // look out for transparent elements which may
+        // still warrant full page redraw.
+        if (pGui->bRedrawPartialEn) {
+          // Is the element transparent?
+          // FIXME: Instead of forcing full page redraw, consider
+          // using clipping region for partial redraw
+          if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
+            bRedrawFullPage = true;
+          }
+        } else {
+          bRedrawFullPage = true;
+        }
+
+        if (bRedrawFullPage) {
+          // Determined that full page needs redraw
+          // so no need to check any more elements
+          break;
+        }
+
+      }
+    }
+
+  } // nStackPage
+
+  if (bRedrawFullPage) {
+    // Mark the entire screen as requiring redraw
+    gslc_PageRedrawSet(pGui,true);
+  }
+
+}
+
+uint8_t gslc_PageRedrawOccluders(gslc_tsGui* pGui,gslc_tsOccluder* asOccluder)
+{
+  int               nInd;
+  int               nPage;
+  uint8_t           nOccluderCnt = 0;
+  gslc_tsPage*      pPage = NULL;
+  gslc_tsCollect*   pCollect = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsElem*      pElem = NULL;
+  uint8_t           nFeatures;
+  #if (GSLC_USE_PROGMEM)
+  bool              bProg;
+  #endif
+
+  // Search from the top of the page stack down since the elements
+  // with the highest Z-index may cover the most elements
+  for (nPage=GSLC_STACK__MAX-1;nPage>=0;nPage--) {
+    pPage = pGui->apPageStack[nPage];
+    if (!pPage) {
+      continue;
+    }
+    pCollect = &pPage->sCollect;
+    for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+        continue;
+      }
+      // Only fetch the fields required rather than the entire
+      // element (if in FLASH)
+      pElem = pElemRef->pElem;
+      #if (GSLC_USE_PROGMEM)
+      bProg = ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG);
+      nFeatures = (bProg)? pgm_read_byte(&pElem->nFeatures) : pElem->nFeatures;
+      #else
+      nFeatures = pElem->nFeatures;
+      #endif
+      // Only filled elements of a type that paints its full bounds
+      // completely cover their region
+      if ((nFeatures & (GSLC_ELEM_FEA_FILL_EN | GSLC_ELEM_FEA_OPAQUE)) !=
+          (GSLC_ELEM_FEA_FILL_EN | GSLC_ELEM_FEA_OPAQUE)) {
+        continue;
+      }
+      #if (GSLC_USE_PROGMEM)
+      if (bProg) {
+        memcpy_P(&asOccluder[nOccluderCnt].rElem,&pElem->rElem,sizeof(gslc_tsRect));
+      } else {
+        asOccluder[nOccluderCnt].rElem = pElem->rElem;
+      }
+      #else
+      asOccluder[nOccluderCnt].rElem = pElem->rElem;
+      #endif
+      asOccluder[nOccluderCnt].nStackPage = (int8_t)nPage;
+      asOccluder[nOccluderCnt].nElemInd   = (int16_t)nInd;
+      nOccluderCnt++;
+      if (nOccluderCnt >= GSLC_REDRAW_OCCLUDE_MAX) {
+        return nOccluderCnt;
+      }
+    }
+  }
+  return nOccluderCnt;
+}
+
+bool gslc_PageRedrawOccluded(const gslc_tsOccluder* asOccluder,uint8_t nOccluderCnt,
+  int8_t nStackPage,int16_t nElemInd,gslc_tsRect rRegion)
+{
+  uint8_t           nInd;
+  const gslc_tsOccluder* pOccluder;
+
+  // Only the elements that are drawn after the element can cover it
+  for (nInd=0;nInd<nOccluderCnt;nInd++) {
+    pOccluder = &asOccluder[nInd];
+    if ((pOccluder->nStackPage < nStackPage) ||
+        ((pOccluder->nStackPage == nStackPage) && (pOccluder->nElemInd <= nElemInd))) {
+      // The remaining records are all drawn before the element
+      break;
+    }
+    if (gslc_IsRectInRect(rRegion,pOccluder->rElem)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void gslc_PageRedrawRgn(gslc_tsGui* pGui)
+{
+  if (!pGui->bInvalidateEn) {
+    return;
+  }
+
+  int               nInd;
+  int               nStackPage;
+  gslc_tsPage*      pPage = NULL;
+  gslc_tsCollect*   pCollect = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsElem*      pElem = NULL;
+  gslc_tsRect       rRgn = pGui->rInvalidateRect;
+  gslc_tsRect       rElem;
+  gslc_tsRect       rElemRgn;
+  gslc_teRedrawType eRedrawOld;
+  gslc_tsOccluder   asOccluder[GSLC_REDRAW_OCCLUDE_MAX];
+  uint8_t           nOccluderCnt;
+
+  gslc_InvalidateRgnReset(pGui);
+
+  // The region is redrawn across the underlying pages, so any
+  // display region saved under a popup may no longer be valid
+  if (pGui->bPopupSaveValid) {
+    gslc_tsRect rSaveRgn = pGui->rPopupSave;
+    if (gslc_ClipRect(&rRgn,&rSaveRgn)) {
+      gslc_PopupSaveDiscard(pGui);
+    }
+  }
+
+  // Redraw the background revealed within the region
+  // - If the driver can't clip, then fall back to a full page redraw
+  // - If the current page has an up-to-date static layer, the region
+  //   is copied from it instead (including the static elements)
+  if (!gslc_SetClipRect(pGui,&rRgn)) {
+    gslc_PageRedrawSet(pGui,true);
+    return;
+  }
+  bool bStaticDrawn = false;
+#if (DRV_HAS_DRAW_LAYER)
+  gslc_tsPage* pPageStatic = gslc_PageStaticLayerGet(pGui);
+  if (pPageStatic != NULL) {
+    bStaticDrawn = gslc_DrvLayerRestore(pGui,pPageStatic->pvStaticLayer,rRgn);
+  }
+#endif
+  if (!bStaticDrawn) {
+    gslc_DrvDrawBkgnd(pGui);
+  }
+
+  // Redraw the elements that intersect the region
+  // - Note that the region is redrawn across the entire page stack
+  //   (including pages with redraw disabled) since the background
+  //   has been restored underneath them
+  nOccluderCnt = gslc_PageRedrawOccluders(pGui,asOccluder);
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    pPage = pGui->apPageStack[nStackPage];
+    if (!pPage) {
+      continue;
+    }
+    pCollect = &pPage->sCollect;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+        continue;
+      }
+      if ((bStaticDrawn) && (nStackPage != GSLC_STACK_OVERLAY) && (gslc_ElemGetStatic(pGui,pElemRef))) {
+        continue;
+      }
+      // Note that a local copy of the element's region is used since
+      // the element (if in Flash) may be fetched into temporary storage
+      // that is reused when checking the other elements
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      rElem = pElem->rElem;
+      rElemRgn = rElem;
+      if ((rElemRgn.w == 0) || (rElemRgn.h == 0) || (!gslc_ClipRect(&rRgn,&rElemRgn))) {
+        continue;
+      }
+      if (gslc_PageRedrawOccluded(asOccluder,nOccluderCnt,nStackPage,nInd,rElemRgn)) {
+        pGui->nRedrawCullCnt++;
+        continue;
+      }
+
+      // Only the portion of the element inside the region is redrawn
+      // - If the element was already marked for redraw then it still
+      //   needs a full redraw unless it is completely inside the region
+      // - The clipping region is restored before each element in case
+      //   an element has changed it during its own redraw
+      eRedrawOld = gslc_ElemGetRedraw(pGui,pElemRef);
+      gslc_SetClipRect(pGui,&rRgn);
+      gslc_ElemDrawByRef(pGui,pElemRef,GSLC_REDRAW_FULL);
+      pGui->nRedrawDrawCnt++;
+      if ((eRedrawOld != GSLC_REDRAW_NONE) && (!gslc_IsRectInRect(rElem,rRgn))) {
+        gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+      }
+    }
+  }
+
+  gslc_SetClipRect(pGui,NULL);
+  gslc_PageFlipSet(pGui,true);
+}
+
+// Redraw the active page
+// - If the page has been marked as needing redraw, then all
+//   elements are rendered
+// - If the page has not been marked as needing redraw then only
+//   the elements that have been marked as needing redraw
+//   are rendered.
+void gslc_PageRedrawGo(gslc_tsGui* pGui)
+{
+  int               nInd;
+  gslc_tsCollect*   pCollect = NULL;
+  gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsElem*      pElem = NULL;
+  gslc_tsRect       rElem;
+  gslc_tsOccluder   asOccluder[GSLC_REDRAW_OCCLUDE_MAX];
+  uint8_t           nOccluderCnt;
+
+  // Reset the redraw statistics
+  pGui->nRedrawDrawCnt = 0;
+  pGui->nRedrawCullCnt = 0;
+
+  // Update any page redraw status that may be required
+  // - Note that this routine handles cases where an element
+  //   marked as requiring update is semi-transparent which can
+  //   cause other elements to be redrawn as well.
+  gslc_PageRedrawCalc(pGui);
+
+  // Determine final state of full-page redraw
+  bool  bPageRedraw = gslc_PageRedrawGet(pGui);
+
+  // If a full page redraw is required, then start by
+  // redrawing the background.
+  // NOTE:
+  // - It would be cleaner if we could treat the background
+  //   layer like any other element (and hence check for its
+  //   need-redraw status).
+  // - For now, assume background doesn't need update except
+  //   if the entire page is to be redrawn
+  //   TODO: Fix this assumption (either add specific flag
+  //         for bBkgndNeedRedraw or make the background just
+  //         another element).
+  // - A pre-rendered page provides the entire page (except for
+  //   any overlay), otherwise if the current page has a static layer
+  //   it provides the background and the static elements
+  // - If a full page redraw isn't required, start by redrawing any
+  //   invalidated region (eg. revealed by hiding an element) before
+  //   the elements marked for redraw. This may fall back to a full
+  //   page redraw.
+  bool  bPrerenderDrawn = false;
+  bool  bStaticDrawn = false;
+  if (!bPageRedraw) {
+    gslc_PageRedrawRgn(pGui);
+    bPageRedraw = gslc_PageRedrawGet(pGui);
+  }
+  if (bPageRedraw) {
+    bPrerenderDrawn = gslc_PagePrerenderDraw(pGui);
+    if (!bPrerenderDrawn) {
+      bStaticDrawn = gslc_PageStaticLayerDraw(pGui);
+    }
+    if ((!bPrerenderDrawn) && (!bStaticDrawn)) {
+      gslc_DrvDrawBkgnd(pGui);
+    }
+    gslc_PageFlipSet(pGui,true);
+    // The full redraw covers any invalidated region
+    gslc_InvalidateRgnReset(pGui);
+    // The underlying pages are redrawn in their current state, so
+    // any display region saved under a popup is no longer valid
+    gslc_PopupSaveDiscard(pGui);
+  }
+
+  // Draw other elements (as needed, unless forced page redraw)
+  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
+  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
+
+  // Issue redraw events to the elements of all pages in stack
+  // - Start from bottom page in stack first
+  // - Elements that are completely covered by an opaque element
+  //   with a higher Z-index (eg. on an overlay or popup page) are
+  //   culled rather than drawn. A culled element keeps any pending
+  //   redraw so that it is drawn once uncovered, as a popup may
+  //   restore the display region saved under it when hidden. Upon a
+  //   full page redraw the pending redraw is dropped instead, since
+  //   any saved region has been discarded and the revealed region
+  //   is redrawn when the covering element is hidden.
+  nOccluderCnt = gslc_PageRedrawOccluders(pGui,asOccluder);
+  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
+    if (!pStackPage) {
+      continue;
+    }
+    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
+      // When doing a full page redraw, proceed as normal
+      // When only doing a parital page redraw, check to see if
+      // the page has been marked as redraw-disabled. If so, skip
+      // updating the elements on the page.
+      //
+      // The redraw-disabled mode is useful to prevent "show-through"
+      // from dynamically-updating elements in lower layers of the
+      // page stack (this may occur with popup dialogs). If the overlay
+      // page does not overlap dynamically-updating elements, then
+      // DoDraw can be set to true, enabling background updates to occur.
+      continue;
+    }
+    pCollect = &pStackPage->sCollect;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if ((!bPageRedraw) && (gslc_ElemGetRedraw(pGui,pElemRef) == GSLC_REDRAW_NONE)) {
+        continue;
+      }
+      if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+        continue;
+      }
+      if ((nStackPage != GSLC_STACK_OVERLAY) &&
+          ((bPrerenderDrawn) || ((bStaticDrawn) && (gslc_ElemGetStatic(pGui,pElemRef))))) {
+        // Already drawn from the pre-rendered page or static layer
+        gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+        continue;
+      }
+      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+      rElem = pElem->rElem;
+      if (gslc_PageRedrawOccluded(asOccluder,nOccluderCnt,nStackPage,nInd,rElem)) {
+        if (bPageRedraw) {
+          gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+        }
+        pGui->nRedrawCullCnt++;
+        continue;
+      }
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,(void*)(pElemRef),NULL);
+      gslc_ElemEvent(pGui,sEvent);
+      pGui->nRedrawDrawCnt++;
+    }
+  }
+
+  #ifdef DBG_REDRAW
+  if ((pGui->nRedrawDrawCnt > 0) || (pGui->nRedrawCullCnt > 0)) {
+    GSLC_DEBUG_PRINT("Redraw: page=%u drawn=%u culled=%u\n",bPageRedraw,
+      pGui->nRedrawDrawCnt,pGui->nRedrawCullCnt);
+  }
+  #endif
+
+
+  // Clear the page redraw flag
+  gslc_PageRedrawSet(pGui,false);
+
+  // Page flip the entire screen
+  // - TODO: We could also call Update instead of Flip as that would
+  //         limit the region to refresh.
+  gslc_PageFlipGo(pGui);
+
+}
+
+
+void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
+{
+  if (pGui == NULL) {
+    return;
+  }
+
+  pGui->bScreenNeedFlip = bNeeded;
+
+  // To assist in debug of drawing primitives, support immediate
+  // rendering of the current display. Note that this only works
+  // for display drivers that don't invalidate the double-buffer (eg. SDL1.2)
+#ifdef DBG_DRAW_IMM
+  gslc_DrvPageFlipNow(pGui);
+#endif
+}
+
+bool gslc_PageFlipGet(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return false;
+  }
+
+  return pGui->bScreenNeedFlip;
+}
+
+void gslc_PageFlipGo(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    return;
+  }
+
+  if (pGui->bScreenNeedFlip) {
+    gslc_DrvPageFlipNow(pGui);
+
+    // Indicate that page flip is no longer required
+    gslc_PageFlipSet(pGui,false);
+  }
+}
+
+
+gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
+{
+  int8_t nInd;
+
+  // Loop through list of pages
+  // Return pointer to page
+  gslc_tsPage*  pFoundPage = NULL;
+  for (nInd=0;nInd<pGui->nPageMax;nInd++) {
+    if (pGui->asPage[nInd].nPageId == nPageId) {
+      pFoundPage = &pGui->asPage[nInd];
+      break;
+    }
+  }
+
+  // Error handling: if not found, make this a fatal error
+  // as it shows a serious config error and continued operation
+  // is not viable.
+  if (pFoundPage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: PageFindById() can't find page (ID=%d)\n",nPageId);
+    return NULL;
+  }
+
+  return pFoundPage;
+}
+
+gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
+{
+  gslc_tsPage*    pPage = NULL;
+  gslc_tsElemRef* pElemRef = NULL;
+
+  // Get the page
+  pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: PageFindElemById() can't find page (ID=%d)\n",nPageId);
+    return NULL;
+  }
+  // Find the element reference in the page's element collection
+  pElemRef = gslc_CollectFindElemById(pGui,&pPage->sCollect,nElemId);
+  return pElemRef;
+}
+
+/* UNUSED
+void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
+{
+  if ((pPage == NULL) || (funcCb == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "PageSetEventFunc";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pPage->pfuncXEvent       = funcCb;
+}
+*/
+
+
+// TODO: Create a PageStackFocusStep()
+// - The functionality would track which page is currently focused
+//   and instead of looping around on the page, the next enabled
+//   page in the stack would be traversed.
+// - Wrapping at the bottom of the stack would create the GSLC_IND_NONE
+//   state.
+// - Without this enhancement, GPIO / keyboard controls will only
+//   operate on the top-most page in the stack, which prevents the
+//   ability to navigate tab select controls if they are provided
+//   by a lower layer in the stack.
+
+
+int16_t gslc_PageFocusStep(gslc_tsGui* pGui, gslc_tsPage* pPage, bool bNext)
+{
+#if !(GSLC_FEATURE_INPUT)
+  return GSLC_IND_NONE;
+#else
+  bool              bWrapped = false;
+  bool              bFound = false;
+  int16_t           nInd = GSLC_IND_NONE;
+  gslc_tsCollect* pCollect = &pPage->sCollect;
+
+  bFound = gslc_CollectFindFocusStep(pGui, pCollect, bNext, &bWrapped, &nInd);
+  if (!bFound) {
+    nInd = GSLC_IND_NONE;
+  } else {
+    if (bWrapped) {
+      // Optionally pause here
+      // If we wrap, then disable current focus for this particular step
+      nInd = GSLC_IND_NONE;
+    }
+  }
+  gslc_CollectSetFocus(pGui,pCollect,nInd);
+  return nInd;
+#endif
+}
+
+
+// ------------------------------------------------------------------------
+// Element General Functions
+// ------------------------------------------------------------------------
+
+
+int gslc_ElemGetId(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  return pElem->nId;
+}
+
+
+// Get a flag from an element reference
+// Note that the flag remains aligned to the position within the flags bitfield
+uint8_t gslc_GetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlagMask)
+{
+  if (!pElemRef) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetElemRefFlag";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  return pElemRef->eElemFlags & nFlagMask;
+}
+
+// Set a flag in an element reference
+// Note that the nFlagVal must be aligned to the nFlagMask
+void gslc_SetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlagMask,uint8_t nFlagVal)
+{
+  if (!pElemRef) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetElemRefFlag";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  uint8_t nCurFlags = pElemRef->eElemFlags;
+  uint8_t nNewFlags = (nCurFlags & ~nFlagMask) | nFlagVal;
+  pElemRef->eElemFlags = nNewFlags;
+}
+
+// Returns a pointer to an element from an element reference
+// - Handle caching from FLASH if element is accessed via PROGMEM
+gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (!pElemRef) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetElemFromRef";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  gslc_teElemRefFlags eFlags  = pElemRef->eElemFlags;
+  gslc_tsElem*        pElem   = pElemRef->pElem;
+
+  // If the element is in FLASH and requires PROGMEM to access
+  // then cache it locally and return a pointer to the global
+  // temporary element instead so that further accesses can
+  // be direct.
+  if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
+    // TODO: Optimize by checking to see if we already cached this element
+    // - Can probably do this by comparing the bValid and nId
+    #if (GSLC_USE_PROGMEM)
+    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
+    pElem = &pGui->sElemTmpProg;
+    #endif
+  } else if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_CONST) {
+    // We are running on device that may support FLASH storage
+    // simply by using a const declaration. No special
+    // PROGMEM access mechanism is required, therefore it is
+    // not necessary to copy to the temporary RAM element.
+    // An example device using this mode is Cortex-M0.
+    // No explicit copy from FLASH is required.
+  } else {
+    // SRC_ELEMREF_SRC_RAM
+    // No copy required
   }
+  return pElem;
+}
 
-  // Draw other elements (as needed, unless forced page redraw)
-  // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
-  uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
-  void*    pvData = NULL;
 
-  // Issue page redraw events to all pages in stack
-  // - Start from bottom page in stack first
-  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
-    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
-    if (!pStackPage) {
-      continue;
-    }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
-      // When only doing a parital page redraw, check to see if
-      // the page has been marked as redraw-disabled. If so, skip
-      // updating the elements on the page.
-      //
-      // The redraw-disabled mode is useful to prevent "show-through"
-      // from dynamically-updating elements in lower layers of the
-      // page stack (this may occur with popup dialogs). If the overlay
-      // page does not overlap dynamically-updating elements, then
-      // DoDraw can be set to true, enabling background updates to occur.
-      continue;
-    }
-    pvData = (void*)(pStackPage);
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
-    gslc_PageEvent(pGui,sEvent);
+#if (GSLC_STR_ARENA)
+// ------------------------------------------------------------------------
+// String Arena Functions
+// ------------------------------------------------------------------------
+
+// Size of the string buffer for a size class
+static uint8_t gslc_StrClassSize(uint8_t nClass)
+{
+  return (nClass < GSLC_STR_CLASS_CNT-1)? (uint8_t)(8 << nClass) : 255;
+}
+
+// Determine if a string buffer is located in the string arena
+static bool gslc_StrArenaOwns(gslc_tsGui* pGui,const char* pStrBuf)
+{
+  return ((pStrBuf != NULL) &&
+          ((const uint8_t*)pStrBuf >= &pGui->acStrArena[GSLC_STR_HDR_LEN]) &&
+          ((const uint8_t*)pStrBuf < &pGui->acStrArena[pGui->nStrArenaTop]));
+}
+
+// Update the owner of an element's string buffer
+// - Called after an element has been copied (eg. into a collection)
+//   so that compaction can relocate its string buffer
+static void gslc_StrArenaOwn(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  if (gslc_StrArenaOwns(pGui,pElem->pStrBuf)) {
+    memcpy((uint8_t*)pElem->pStrBuf - GSLC_STR_HDR_LEN,&pElem,sizeof(gslc_tsElem*));
   }
+}
 
+// Allocate a string buffer of at least nLen bytes for an element
+// - Strings longer than the largest size class are truncated
+// - On success the element's string buffer is assigned but the
+//   content is undefined. On failure the element is unchanged.
+// - The element is only recorded as the owner of the block if bOwn
+//   is set. Elements that are still being created (and will be
+//   copied into a collection) leave the block without an owner
+//   until gslc_StrArenaOwn() is called.
+static bool gslc_StrArenaAlloc(gslc_tsGui* pGui,gslc_tsElem* pElem,size_t nLen,bool bOwn)
+{
+  gslc_tsElem* pOwner = (bOwn)? pElem : NULL;
+  uint8_t   nClass = 0;
+  uint16_t  nBlk;
+  uint16_t  nBlkLen;
+  while ((nClass < GSLC_STR_CLASS_CNT-1) && (gslc_StrClassSize(nClass) < nLen)) {
+    nClass++;
+  }
+  nBlkLen = GSLC_STR_HDR_LEN + gslc_StrClassSize(nClass);
 
-  // Clear the page redraw flag
-  gslc_PageRedrawSet(pGui,false);
+  if (pGui->anStrArenaFree[nClass] != GSLC_STR_BLK_NONE) {
+    // Reuse a free block of the same size class
+    // - The link to the next free block is saved in the string buffer
+    nBlk = pGui->anStrArenaFree[nClass];
+    memcpy(&pGui->anStrArenaFree[nClass],&pGui->acStrArena[nBlk+GSLC_STR_HDR_LEN],sizeof(uint16_t));
+  } else if ((uint32_t)pGui->nStrArenaTop + nBlkLen <= GSLC_STR_ARENA_SIZE) {
+    // Allocate a new block at the top of the arena
+    nBlk = pGui->nStrArenaTop;
+    pGui->nStrArenaTop += nBlkLen;
+    if (pGui->nStrArenaTop > pGui->nStrArenaPeak) {
+      pGui->nStrArenaPeak = pGui->nStrArenaTop;
+    }
+  } else {
+    GSLC_DEBUG_PRINT("ERROR: StrArenaAlloc() string arena full (max=%u) on ElemId=%d\n",
+      GSLC_STR_ARENA_SIZE,pElem->nId);
+    return false;
+  }
+  memcpy(&pGui->acStrArena[nBlk],&pOwner,sizeof(gslc_tsElem*));
+  pGui->acStrArena[nBlk+GSLC_STR_HDR_LEN-1] = nClass;
+  pGui->nStrArenaUsed += nBlkLen;
 
-  // Page flip the entire screen
-  // - TODO: We could also call Update instead of Flip as that would
-  //         limit the region to refresh.
-  gslc_PageFlipGo(pGui);
+  pElem->pStrBuf    = (char*)&pGui->acStrArena[nBlk+GSLC_STR_HDR_LEN];
+  pElem->nStrBufMax = gslc_StrClassSize(nClass);
+  return true;
+}
 
+// Release a string buffer back to the free list of its size class
+static void gslc_StrArenaFree(gslc_tsGui* pGui,char* pStrBuf)
+{
+  if (!gslc_StrArenaOwns(pGui,pStrBuf)) {
+    return;
+  }
+  gslc_tsElem*  pOwner = NULL;
+  uint16_t      nBlk = (uint16_t)((uint8_t*)pStrBuf - pGui->acStrArena) - GSLC_STR_HDR_LEN;
+  uint8_t       nClass = pGui->acStrArena[nBlk+GSLC_STR_HDR_LEN-1];
+  memcpy(&pGui->acStrArena[nBlk],&pOwner,sizeof(gslc_tsElem*));
+  memcpy(pStrBuf,&pGui->anStrArenaFree[nClass],sizeof(uint16_t));
+  pGui->anStrArenaFree[nClass] = nBlk;
+  pGui->nStrArenaUsed -= GSLC_STR_HDR_LEN + gslc_StrClassSize(nClass);
 }
 
+void gslc_StrArenaCompact(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "StrArenaCompact";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  uint16_t      nBlkSrc = 0;
+  uint16_t      nBlkDst = 0;
+  uint16_t      nBlkLen;
+  uint8_t       nClass;
+  gslc_tsElem*  pOwner;
+
+  // Slide all allocated blocks down over the free blocks and
+  // relocate the string buffers of their owner elements
+  // - Blocks without an owner belong to elements that were never
+  //   added to a collection, so they are released along with the
+  //   free blocks
+  while (nBlkSrc < pGui->nStrArenaTop) {
+    memcpy(&pOwner,&pGui->acStrArena[nBlkSrc],sizeof(gslc_tsElem*));
+    nClass  = pGui->acStrArena[nBlkSrc+GSLC_STR_HDR_LEN-1];
+    nBlkLen = GSLC_STR_HDR_LEN + gslc_StrClassSize(nClass);
+    if (pOwner != NULL) {
+      if (nBlkDst != nBlkSrc) {
+        memmove(&pGui->acStrArena[nBlkDst],&pGui->acStrArena[nBlkSrc],nBlkLen);
+        pOwner->pStrBuf = (char*)&pGui->acStrArena[nBlkDst+GSLC_STR_HDR_LEN];
+      }
+      nBlkDst += nBlkLen;
+    }
+    nBlkSrc += nBlkLen;
+  }
+  pGui->nStrArenaTop = nBlkDst;
+  pGui->nStrArenaUsed = nBlkDst;
+  for (nClass=0;nClass<GSLC_STR_CLASS_CNT;nClass++) {
+    pGui->anStrArenaFree[nClass] = GSLC_STR_BLK_NONE;
+  }
+}
 
-void gslc_PageFlipSet(gslc_tsGui* pGui,bool bNeeded)
+void gslc_StrArenaGetUsage(gslc_tsGui* pGui,uint16_t* pnUsed,uint16_t* pnPeak)
 {
   if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "StrArenaGetUsage";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
+  if (pnUsed != NULL) { *pnUsed = pGui->nStrArenaUsed; }
+  if (pnPeak != NULL) { *pnPeak = pGui->nStrArenaPeak; }
+}
+#endif // GSLC_STR_ARENA
 
-  pGui->bScreenNeedFlip = bNeeded;
 
-  // To assist in debug of drawing primitives, support immediate
-  // rendering of the current display. Note that this only works
-  // for display drivers that don't invalidate the double-buffer (eg. SDL1.2)
-#ifdef DBG_DRAW_IMM
-  gslc_DrvPageFlipNow(pGui);
+// ------------------------------------------------------------------------
+// Element Style Functions
+// ------------------------------------------------------------------------
+
+const gslc_tsStyle* gslc_StyleGet(gslc_tsGui* pGui,uint8_t nStyleId)
+{
+  if (nStyleId < pGui->nStyleConstCnt) {
+    #if (GSLC_USE_PROGMEM)
+    memcpy_P(&pGui->sStyleTmp,&pGui->asStyleConst[nStyleId],sizeof(gslc_tsStyle));
+    return &pGui->sStyleTmp;
+    #else
+    return &pGui->asStyleConst[nStyleId];
+    #endif
+  }
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  nStyleId -= pGui->nStyleConstCnt;
+  if ((nStyleId < pGui->nStyleCnt) && (pGui->anStyleRef[nStyleId] > 0)) {
+    return &pGui->asStyle[nStyleId];
+  }
 #endif
+  return &STYLE_DEFAULT;
 }
 
-bool gslc_PageFlipGet(gslc_tsGui* pGui)
+#if (GSLC_FEATURE_COMPACT_ELEM)
+// Compare two style records field-wise (ignoring any padding)
+static bool gslc_StyleEqual(const gslc_tsStyle* pStyleA,const gslc_tsStyle* pStyleB)
 {
-  if (pGui == NULL) {
-    return false;
-  }
+  return (gslc_ColorEqual(pStyleA->colFrame,pStyleB->colFrame) &&
+          gslc_ColorEqual(pStyleA->colFill,pStyleB->colFill) &&
+          gslc_ColorEqual(pStyleA->colFrameGlow,pStyleB->colFrameGlow) &&
+          gslc_ColorEqual(pStyleA->colFillGlow,pStyleB->colFillGlow) &&
+          gslc_ColorEqual(pStyleA->colText,pStyleB->colText) &&
+          gslc_ColorEqual(pStyleA->colTextGlow,pStyleB->colTextGlow) &&
+          (pStyleA->eTxtAlign == pStyleB->eTxtAlign) &&
+          (pStyleA->nTxtMargin == pStyleB->nTxtMargin) &&
+          (pStyleA->pTxtFont == pStyleB->pTxtFont));
+}
 
-  return pGui->bScreenNeedFlip;
+// Find an existing style record that matches
+// - Returns the style index or -1 if no match
+static int16_t gslc_StyleFind(gslc_tsGui* pGui,const gslc_tsStyle* pStyle)
+{
+  uint8_t nInd;
+  if (gslc_StyleEqual(pStyle,&STYLE_DEFAULT)) {
+    return GSLC_STYLE_NONE;
+  }
+  for (nInd=0;nInd<pGui->nStyleConstCnt;nInd++) {
+    if (gslc_StyleEqual(pStyle,gslc_StyleGet(pGui,nInd))) {
+      return nInd;
+    }
+  }
+  for (nInd=0;nInd<pGui->nStyleCnt;nInd++) {
+    if ((pGui->anStyleRef[nInd] > 0) && (gslc_StyleEqual(pStyle,&pGui->asStyle[nInd]))) {
+      return pGui->nStyleConstCnt + nInd;
+    }
+  }
+  return -1;
 }
 
-void gslc_PageFlipGo(gslc_tsGui* pGui)
+// Adjust the reference count of a runtime style record
+static void gslc_StyleRef(gslc_tsGui* pGui,uint8_t nStyleId,int8_t nDelta)
 {
-  if (pGui == NULL) {
+  if ((nStyleId == GSLC_STYLE_NONE) || (nStyleId < pGui->nStyleConstCnt)) {
+    // Default and constant style records are not reference counted
     return;
   }
+  nStyleId -= pGui->nStyleConstCnt;
+  if (nStyleId >= pGui->nStyleCnt) {
+    return;
+  }
+  if ((nDelta < 0) && (pGui->anStyleRef[nStyleId] == 0)) {
+    return;
+  }
+  pGui->anStyleRef[nStyleId] += nDelta;
+}
 
-  if (pGui->bScreenNeedFlip) {
-    gslc_DrvPageFlipNow(pGui);
-
-    // Indicate that page flip is no longer required
-    gslc_PageFlipSet(pGui,false);
+const gslc_tsImgRef* gslc_ElemGetImgRef(const gslc_tsElem* pElem)
+{
+  // Empty image references for elements without any allocated
+  static const gslc_tsImgRef asImgRefNone[2] = {
+    {NULL,NULL,GSLC_IMGREF_NONE,NULL},
+    {NULL,NULL,GSLC_IMGREF_NONE,NULL}
+  };
+  if (pElem->pImgRef == NULL) {
+    return asImgRefNone;
   }
+  return pElem->pImgRef;
 }
+#endif // GSLC_FEATURE_COMPACT_ELEM
 
+void gslc_ElemStyleGet(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsStyle* pStyle)
+{
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  *pStyle = *gslc_StyleGet(pGui,pElem->nStyle);
+#else
+  pStyle->colFrame      = pElem->colElemFrame;
+  pStyle->colFill       = pElem->colElemFill;
+  pStyle->colFrameGlow  = pElem->colElemFrameGlow;
+  pStyle->colFillGlow   = pElem->colElemFillGlow;
+  pStyle->colText       = pElem->colElemText;
+  pStyle->colTextGlow   = pElem->colElemTextGlow;
+  pStyle->eTxtAlign     = pElem->eTxtAlign;
+  pStyle->nTxtMargin    = pElem->nTxtMargin;
+  pStyle->pTxtFont      = pElem->pTxtFont;
+#endif
+}
 
-gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId)
+void gslc_ElemStyleSet(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsStyle* pStyle)
 {
-  int8_t nInd;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  uint8_t nStyleOld = pElem->nStyle;
+  int16_t nStyleNew = gslc_StyleFind(pGui,pStyle);
+  if (nStyleNew < 0) {
+    // No matching style record exists yet
+    if ((nStyleOld != GSLC_STYLE_NONE) && (nStyleOld >= pGui->nStyleConstCnt) &&
+        (pGui->anStyleRef[nStyleOld - pGui->nStyleConstCnt] == 1)) {
+      // The element is the only user of its current style record,
+      // so modify the record in place
+      pGui->asStyle[nStyleOld - pGui->nStyleConstCnt] = *pStyle;
+      return;
+    }
+    // Allocate a new style record, reusing any that are unreferenced
+    uint8_t nInd;
+    for (nInd=0;nInd<pGui->nStyleCnt;nInd++) {
+      if (pGui->anStyleRef[nInd] == 0) {
+        break;
+      }
+    }
+    if (nInd >= GSLC_STYLE_MAX) {
+      GSLC_DEBUG_PRINT("ERROR: ElemStyleSet() too many styles (max=%u)\n",GSLC_STYLE_MAX);
+      return;
+    }
+    if (nInd == pGui->nStyleCnt) {
+      pGui->nStyleCnt++;
+    }
+    pGui->asStyle[nInd] = *pStyle;
+    nStyleNew = pGui->nStyleConstCnt + nInd;
+  }
+  if (nStyleNew == nStyleOld) {
+    return;
+  }
+  gslc_StyleRef(pGui,(uint8_t)nStyleNew,1);
+  gslc_StyleRef(pGui,nStyleOld,-1);
+  pElem->nStyle = (uint8_t)nStyleNew;
+#else
+  pElem->colElemFrame     = pStyle->colFrame;
+  pElem->colElemFill      = pStyle->colFill;
+  pElem->colElemFrameGlow = pStyle->colFrameGlow;
+  pElem->colElemFillGlow  = pStyle->colFillGlow;
+  pElem->colElemText      = pStyle->colText;
+  pElem->colElemTextGlow  = pStyle->colTextGlow;
+  pElem->eTxtAlign        = pStyle->eTxtAlign;
+  pElem->nTxtMargin       = pStyle->nTxtMargin;
+  pElem->pTxtFont         = pStyle->pTxtFont;
+#endif
+}
 
-  // Loop through list of pages
-  // Return pointer to page
-  gslc_tsPage*  pFoundPage = NULL;
-  for (nInd=0;nInd<pGui->nPageMax;nInd++) {
-    if (pGui->asPage[nInd].nPageId == nPageId) {
-      pFoundPage = &pGui->asPage[nInd];
+bool gslc_ElemImgRefAlloc(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  if (pElem->pImgRef != NULL) {
+    return true;
+  }
+  // Reuse any pair released by gslc_ElemImgRefFree()
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nElemImgCnt;nInd++) {
+    if (!pGui->abElemImgUsed[nInd]) {
       break;
     }
   }
-
-  // Error handling: if not found, make this a fatal error
-  // as it shows a serious config error and continued operation
-  // is not viable.
-  if (pFoundPage == NULL) {
-    GSLC_DEBUG_PRINT("ERROR: PageFindById() can't find page (ID=%d)\n",nPageId);
-    return NULL;
+  if (nInd >= GSLC_ELEM_IMG_MAX) {
+    GSLC_DEBUG_PRINT("ERROR: ElemImgRefAlloc() too many element images (max=%u)\n",GSLC_ELEM_IMG_MAX);
+    return false;
   }
-
-  return pFoundPage;
+  if (nInd == pGui->nElemImgCnt) {
+    pGui->nElemImgCnt++;
+  }
+  pGui->abElemImgUsed[nInd] = true;
+  pElem->pImgRef    = &pGui->asElemImgRef[2*nInd];
+  pElem->pImgRef[0] = gslc_ResetImage();
+  pElem->pImgRef[1] = gslc_ResetImage();
+#endif
+  return true;
 }
 
-gslc_tsElemRef* gslc_PageFindElemById(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
+void gslc_ElemImgRefFree(gslc_tsGui* pGui,gslc_tsElem* pElem)
 {
-  gslc_tsPage*    pPage = NULL;
-  gslc_tsElemRef* pElemRef = NULL;
-
-  // Get the page
-  pPage = gslc_PageFindById(pGui,nPageId);
-  if (pPage == NULL) {
-    GSLC_DEBUG_PRINT("ERROR: PageFindElemById() can't find page (ID=%d)\n",nPageId);
-    return NULL;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  if ((pElem->pImgRef < pGui->asElemImgRef) || (pElem->pImgRef >= pGui->asElemImgRef + 2*GSLC_ELEM_IMG_MAX)) {
+    // No image references allocated from the pool
+    return;
   }
-  // Find the element reference in the page's element collection
-  pElemRef = gslc_CollectFindElemById(pGui,&pPage->sCollect,nElemId);
-  return pElemRef;
+  pGui->abElemImgUsed[(pElem->pImgRef - pGui->asElemImgRef) / 2] = false;
+  pElem->pImgRef = NULL;
+#endif
 }
 
-/* UNUSED
-void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT funcCb)
+void gslc_SetStyleTable(gslc_tsGui* pGui,const gslc_tsStyle* asStyle,uint8_t nStyleCnt)
 {
-  if ((pPage == NULL) || (funcCb == NULL)) {
-    static const char GSLC_PMEM FUNCSTR[] = "PageSetEventFunc";
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetStyleTable";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  pPage->pfuncXEvent       = funcCb;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  // The style indices of the table and runtime style records
+  // must remain distinct from GSLC_STYLE_NONE
+  if ((uint16_t)nStyleCnt + GSLC_STYLE_MAX >= GSLC_STYLE_NONE) {
+    GSLC_DEBUG_PRINT("ERROR: SetStyleTable() too many styles (%u)\n",nStyleCnt);
+    return;
+  }
+  // The style indices of existing elements would be invalidated
+  if (pGui->nStyleCnt > 0) {
+    GSLC_DEBUG_PRINT("ERROR: SetStyleTable() called after styles were added%s\n","");
+    return;
+  }
+#endif
+  pGui->asStyleConst    = asStyle;
+  pGui->nStyleConstCnt  = (asStyle == NULL)? 0 : nStyleCnt;
 }
-*/
-
-
-// TODO: Create a PageStackFocusStep()
-// - The functionality would track which page is currently focused
-//   and instead of looping around on the page, the next enabled
-//   page in the stack would be traversed.
-// - Wrapping at the bottom of the stack would create the GSLC_IND_NONE
-//   state.
-// - Without this enhancement, GPIO / keyboard controls will only
-//   operate on the top-most page in the stack, which prevents the
-//   ability to navigate tab select controls if they are provided
-//   by a lower layer in the stack.
 
-
-int16_t gslc_PageFocusStep(gslc_tsGui* pGui, gslc_tsPage* pPage, bool bNext)
+void gslc_ElemSetStyleId(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nStyleId)
 {
-#if !(GSLC_FEATURE_INPUT)
-  return GSLC_IND_NONE;
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemSetStyleId";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (nStyleId >= pGui->nStyleConstCnt) {
+    GSLC_DEBUG_PRINT("ERROR: ElemSetStyleId() invalid style (%u)\n",nStyleId);
+    return;
+  }
+  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  // Reference the constant style record directly
+  gslc_StyleRef(pGui,pElem->nStyle,-1);
+  pElem->nStyle = nStyleId;
 #else
-  bool              bWrapped = false;
-  bool              bFound = false;
-  int16_t           nInd = GSLC_IND_NONE;
-  gslc_tsCollect* pCollect = &pPage->sCollect;
+  gslc_ElemStyleSet(pGui,pElem,gslc_StyleGet(pGui,nStyleId));
+#endif
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
 
-  bFound = gslc_CollectFindFocusStep(pGui, pCollect, bNext, &bWrapped, &nInd);
-  if (!bFound) {
-    nInd = GSLC_IND_NONE;
-  } else {
-    if (bWrapped) {
-      // Optionally pause here
-      // If we wrap, then disable current focus for this particular step
-      nInd = GSLC_IND_NONE;
-    }
+void gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const gslc_tsStyle* pStyle)
+{
+  if ((pGui == NULL) || (pElemRef == NULL) || (pStyle == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemSetStyle";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
   }
-  gslc_CollectSetFocus(pGui,pCollect,nInd);
-  return nInd;
-#endif
+  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_ElemStyleSet(pGui,pElem,pStyle);
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
+void gslc_ElemGetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsStyle* pStyle)
+{
+  if ((pGui == NULL) || (pElemRef == NULL) || (pStyle == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemGetStyle";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_ElemStyleGet(pGui,pElem,pStyle);
 }
 
 
 // ------------------------------------------------------------------------
-// Element General Functions
+// Element Callback Functions
 // ------------------------------------------------------------------------
 
+// Locate the dispatch table of a registered element type
+// - The table may be stored in PROGMEM
+static const gslc_tsElemType* gslc_ElemTypeFind(gslc_tsGui* pGui,int16_t nType)
+{
+  if ((nType < GSLC_TYPE_BASE_EXTEND) || (nType - GSLC_TYPE_BASE_EXTEND >= GSLC_ELEMTYPE_MAX)) {
+    return NULL;
+  }
+  return pGui->apElemType[nType - GSLC_TYPE_BASE_EXTEND];
+}
 
-int gslc_ElemGetId(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+// Fetch the dispatch table of a registered element type
+// - Copied from FLASH to RAM if stored in PROGMEM
+static bool gslc_ElemTypeGet(gslc_tsGui* pGui,int16_t nType,gslc_tsElemType* pElemType)
 {
-  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  return pElem->nId;
+  const gslc_tsElemType* pTbl = gslc_ElemTypeFind(pGui,nType);
+  if (pTbl == NULL) {
+    return false;
+  }
+  #if (GSLC_USE_PROGMEM)
+  memcpy_P(pElemType,pTbl,sizeof(gslc_tsElemType));
+  #else
+  *pElemType = *pTbl;
+  #endif
+  return true;
+}
+
+// Notify the element type that an element has been added to a
+// collection (bLink=true) or is about to be removed (bLink=false)
+// - Returns true if the element was linked before the call
+static bool gslc_ElemTypeLink(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsElemRef* pElemRef,bool bLink)
+{
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsElemType sElemType;
+  if (!gslc_ElemTypeGet(pGui,pElem->nType,&sElemType) || (sElemType.pfuncXLink == NULL)) {
+    return false;
+  }
+  return (*sElemType.pfuncXLink)((void*)(pGui),(void*)(pCollect),(void*)(pElemRef),bLink);
 }
 
+void gslc_ElemCbOvrGet(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsElemType* pElemCb)
+{
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  if (pElem->nCbOvr < pGui->nElemCbCnt) {
+    *pElemCb = pGui->asElemCb[pElem->nCbOvr];
+    return;
+  }
+  pElemCb->pfuncXDraw   = NULL;
+  pElemCb->pfuncXTouch  = NULL;
+  pElemCb->pfuncXTick   = NULL;
+#else
+  pElemCb->pfuncXDraw   = pElem->pfuncXDraw;
+  pElemCb->pfuncXTouch  = pElem->pfuncXTouch;
+  pElemCb->pfuncXTick   = pElem->pfuncXTick;
+#endif
+  pElemCb->pfuncXLink   = NULL;
+  pElemCb->nType        = pElem->nType;
+}
 
-// Get a flag from an element reference
-// Note that the flag remains aligned to the position within the flags bitfield
-uint8_t gslc_GetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlagMask)
+bool gslc_ElemCbOvrSet(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsElemType* pElemCb)
 {
-  if (!pElemRef) {
-    static const char GSLC_PMEM FUNCSTR[] = "GetElemRefFlag";
-    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return 0;
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  if ((pElemCb->pfuncXDraw == NULL) && (pElemCb->pfuncXTouch == NULL) && (pElemCb->pfuncXTick == NULL)) {
+    pElem->nCbOvr = GSLC_ELEM_CB_NONE;
+    return true;
   }
-  return pElemRef->eElemFlags & nFlagMask;
+  // Share any existing record with the same callbacks
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nElemCbCnt;nInd++) {
+    if ((pGui->asElemCb[nInd].pfuncXDraw == pElemCb->pfuncXDraw) &&
+        (pGui->asElemCb[nInd].pfuncXTouch == pElemCb->pfuncXTouch) &&
+        (pGui->asElemCb[nInd].pfuncXTick == pElemCb->pfuncXTick)) {
+      pElem->nCbOvr = nInd;
+      return true;
+    }
+  }
+  if (pGui->nElemCbCnt >= GSLC_ELEM_CB_MAX) {
+    GSLC_DEBUG_PRINT("ERROR: ElemCbOvrSet() too many element callbacks (max=%u)\n",GSLC_ELEM_CB_MAX);
+    return false;
+  }
+  pGui->asElemCb[nInd] = *pElemCb;
+  pGui->asElemCb[nInd].nType = GSLC_TYPE_NONE;
+  pGui->nElemCbCnt++;
+  pElem->nCbOvr = nInd;
+#else
+  pElem->pfuncXDraw   = pElemCb->pfuncXDraw;
+  pElem->pfuncXTouch  = pElemCb->pfuncXTouch;
+  pElem->pfuncXTick   = pElemCb->pfuncXTick;
+#endif
+  return true;
 }
 
-// Set a flag in an element reference
-// Note that the nFlagVal must be aligned to the nFlagMask
-void gslc_SetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlagMask,uint8_t nFlagVal)
+// Fetch a single callback of an element
+// - Any callback override assigned to the element takes precedence
+//   over the callback in the dispatch table of its element type
+// - Only the requested callback pointer is read (from FLASH if the
+//   table is stored in PROGMEM) rather than copying the records
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  #define GSLC_ELEM_CB_OVR(pGui,pElem,pfunc) \
+    (((pElem)->nCbOvr < (pGui)->nElemCbCnt)? (pGui)->asElemCb[(pElem)->nCbOvr].pfunc : NULL)
+#else
+  #define GSLC_ELEM_CB_OVR(pGui,pElem,pfunc)  ((pElem)->pfunc)
+#endif
+#if (GSLC_USE_PROGMEM)
+  #define GSLC_ELEM_CB_TYPE(pTbl,pfuncOut,pfunc) \
+    memcpy_P(&(pfuncOut),&((pTbl)->pfunc),sizeof(pfuncOut))
+#else
+  #define GSLC_ELEM_CB_TYPE(pTbl,pfuncOut,pfunc)  (pfuncOut) = (pTbl)->pfunc
+#endif
+
+GSLC_CB_DRAW gslc_ElemGetDrawFunc(gslc_tsGui* pGui,gslc_tsElem* pElem)
 {
-  if (!pElemRef) {
-    static const char GSLC_PMEM FUNCSTR[] = "SetElemRefFlag";
-    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return;
+  GSLC_CB_DRAW pfuncXDraw = GSLC_ELEM_CB_OVR(pGui,pElem,pfuncXDraw);
+  if (pfuncXDraw == NULL) {
+    // Fall back to the callback of the element type
+    const gslc_tsElemType* pTbl = gslc_ElemTypeFind(pGui,pElem->nType);
+    if (pTbl != NULL) {
+      GSLC_ELEM_CB_TYPE(pTbl,pfuncXDraw,pfuncXDraw);
+    }
   }
-  uint8_t nCurFlags = pElemRef->eElemFlags;
-  uint8_t nNewFlags = (nCurFlags & ~nFlagMask) | nFlagVal;
-  pElemRef->eElemFlags = nNewFlags;
+  return pfuncXDraw;
 }
 
-// Returns a pointer to an element from an element reference
-// - Handle caching from FLASH if element is accessed via PROGMEM
-gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+GSLC_CB_TOUCH gslc_ElemGetTouchFunc(gslc_tsGui* pGui,gslc_tsElem* pElem)
 {
-  if (!pElemRef) {
-    static const char GSLC_PMEM FUNCSTR[] = "GetElemFromRef";
-    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return NULL;
+  GSLC_CB_TOUCH pfuncXTouch = GSLC_ELEM_CB_OVR(pGui,pElem,pfuncXTouch);
+  if (pfuncXTouch == NULL) {
+    // Fall back to the callback of the element type
+    const gslc_tsElemType* pTbl = gslc_ElemTypeFind(pGui,pElem->nType);
+    if (pTbl != NULL) {
+      GSLC_ELEM_CB_TYPE(pTbl,pfuncXTouch,pfuncXTouch);
+    }
   }
-  gslc_teElemRefFlags eFlags  = pElemRef->eElemFlags;
-  gslc_tsElem*        pElem   = pElemRef->pElem;
+  return pfuncXTouch;
+}
 
-  // If the element is in FLASH and requires PROGMEM to access
-  // then cache it locally and return a pointer to the global
-  // temporary element instead so that further accesses can
-  // be direct.
-  if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
-    // TODO: Optimize by checking to see if we already cached this element
-    // - Can probably do this by comparing the bValid and nId
-    #if (GSLC_USE_PROGMEM)
-    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
-    pElem = &pGui->sElemTmpProg;
-    #endif
-  } else if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_CONST) {
-    // We are running on device that may support FLASH storage
-    // simply by using a const declaration. No special
-    // PROGMEM access mechanism is required, therefore it is
-    // not necessary to copy to the temporary RAM element.
-    // An example device using this mode is Cortex-M0.
-    // No explicit copy from FLASH is required.
-  } else {
-    // SRC_ELEMREF_SRC_RAM
-    // No copy required
+GSLC_CB_TICK gslc_ElemGetTickFunc(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  GSLC_CB_TICK pfuncXTick = GSLC_ELEM_CB_OVR(pGui,pElem,pfuncXTick);
+  if (pfuncXTick == NULL) {
+    // Fall back to the callback of the element type
+    const gslc_tsElemType* pTbl = gslc_ElemTypeFind(pGui,pElem->nType);
+    if (pTbl != NULL) {
+      GSLC_ELEM_CB_TYPE(pTbl,pfuncXTick,pfuncXTick);
+    }
   }
-  return pElem;
+  return pfuncXTick;
 }
 
 
@@ -2138,15 +4375,18 @@ gslc_tsElemRef* gslc_ElemCreateTxt(gslc_tsGui* pGui,int16_t nElemId,int16_t nPag
 {
   gslc_tsElem       sElem;
   gslc_tsElemRef*   pElemRef = NULL;
+  gslc_tsStyle      sStyle;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_TXT,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_BLACK;
-  sElem.colElemFrameGlow  = GSLC_COL_BLACK;
-  sElem.colElemText       = GSLC_COL_YELLOW;
-  sElem.colElemTextGlow   = GSLC_COL_YELLOW;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_BLACK;
+  sStyle.colFrameGlow     = GSLC_COL_BLACK;
+  sStyle.colText          = GSLC_COL_YELLOW;
+  sStyle.colTextGlow      = GSLC_COL_YELLOW;
+  sStyle.eTxtAlign        = GSLC_ALIGN_MID_LEFT;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
-  sElem.eTxtAlign         = GSLC_ALIGN_MID_LEFT;
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -2167,6 +4407,7 @@ gslc_tsElemRef* gslc_ElemCreateBtnTxt(gslc_tsGui* pGui,int16_t nElemId,int16_t n
 {
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
+  gslc_tsStyle    sStyle;
 
   // Ensure the Font has been defined
   if (gslc_FontGet(pGui,nFontId) == NULL) {
@@ -2175,17 +4416,19 @@ gslc_tsElemRef* gslc_ElemCreateBtnTxt(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   }
 
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BTN,rElem,pStrBuf,nStrBufMax,nFontId);
-  sElem.colElemFill       = GSLC_COL_BLUE_DK4;
-  sElem.colElemFillGlow   = GSLC_COL_BLUE_DK1;
-  sElem.colElemFrame      = GSLC_COL_BLUE_DK2;
-  sElem.colElemFrameGlow  = GSLC_COL_BLUE_DK2;
-  sElem.colElemText       = GSLC_COL_WHITE;
-  sElem.colElemTextGlow   = GSLC_COL_WHITE;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLUE_DK4;
+  sStyle.colFillGlow      = GSLC_COL_BLUE_DK1;
+  sStyle.colFrame         = GSLC_COL_BLUE_DK2;
+  sStyle.colFrameGlow     = GSLC_COL_BLUE_DK2;
+  sStyle.colText          = GSLC_COL_WHITE;
+  sStyle.colTextGlow      = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_GLOW_EN;
-  sElem.pfuncXTouch       = cbTouch;
+  gslc_ElemCbOvrSet(pGui,&sElem,&(gslc_tsElemType){GSLC_TYPE_BTN,NULL,cbTouch,NULL});
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -2206,19 +4449,24 @@ gslc_tsElemRef* gslc_ElemCreateBtnImg(gslc_tsGui* pGui,int16_t nElemId,int16_t n
 {
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
+  gslc_tsStyle    sStyle;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BTN,rElem,NULL,0,GSLC_FONT_NONE);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_BLUE_DK2;
-  sElem.colElemFrameGlow  = GSLC_COL_BLUE_DK2;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_BLUE_DK2;
+  sStyle.colFrameGlow     = GSLC_COL_BLUE_DK2;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_GLOW_EN;
-  sElem.pfuncXTouch       = cbTouch;
+  gslc_ElemCbOvrSet(pGui,&sElem,&(gslc_tsElemType){GSLC_TYPE_BTN,NULL,cbTouch,NULL});
   // Update the normal and glowing images
-  gslc_DrvSetElemImageNorm(pGui,&sElem,sImgRef);
-  gslc_DrvSetElemImageGlow(pGui,&sElem,sImgRefSel);
+  if (gslc_ElemImgRefAlloc(pGui,&sElem)) {
+    gslc_DrvSetElemImageNorm(pGui,&sElem,sImgRef);
+    gslc_DrvSetElemImageGlow(pGui,&sElem,sImgRefSel);
+  }
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -2239,11 +4487,14 @@ gslc_tsElemRef* gslc_ElemCreateBox(gslc_tsGui* pGui,int16_t nElemId,int16_t nPag
 {
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
+  gslc_tsStyle    sStyle;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_BOX,rElem,NULL,0,GSLC_FONT_NONE);
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_GRAY;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
   if (nPage != GSLC_PAGE_NONE) {
@@ -2266,14 +4517,17 @@ gslc_tsElemRef* gslc_ElemCreateLine(gslc_tsGui* pGui,int16_t nElemId,int16_t nPa
   gslc_tsElem     sElem;
   gslc_tsElemRef* pElemRef = NULL;
   gslc_tsRect     rRect;
+  gslc_tsStyle    sStyle;
   rRect.x = nX0;
   rRect.y = nY0;
   rRect.w = nX1 - nX0 + 1;
   rRect.h = nY1 - nY0 + 1;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPE_LINE,rRect,NULL,0,GSLC_FONT_NONE);
   // For line elements, we will draw it with the "fill" color
-  sElem.colElemFill       = GSLC_COL_GRAY;
-  sElem.colElemFillGlow   = GSLC_COL_GRAY;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_GRAY;
+  sStyle.colFillGlow      = GSLC_COL_GRAY;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FILL_EN;   // Disable boundary box fill
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;  // Disable boundary box frame
   if (nPage != GSLC_PAGE_NONE) {
@@ -2301,8 +4555,10 @@ gslc_tsElemRef* gslc_ElemCreateImg(gslc_tsGui* pGui,int16_t nElemId,int16_t nPag
   sElem.nFeatures      |= GSLC_ELEM_FEA_FILL_EN;
   sElem.nFeatures      &= ~GSLC_ELEM_FEA_CLICK_EN;
   // Update the normal and glowing images
-  gslc_DrvSetElemImageNorm(pGui,&sElem,sImgRef);
-  gslc_DrvSetElemImageGlow(pGui,&sElem,sImgRef);
+  if (gslc_ElemImgRefAlloc(pGui,&sElem)) {
+    gslc_DrvSetElemImageNorm(pGui,&sElem,sImgRef);
+    gslc_DrvSetElemImageGlow(pGui,&sElem,sImgRef);
+  }
 
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -2394,7 +4650,7 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       // Since we are going to use the callback within the element
       // we need to ensure it is cached in RAM first
       pElemTracked = gslc_GetElemFromRef(pGui,pElemRefTracked);
-      pfuncXTouch = pElemTracked->pfuncXTouch;
+      pfuncXTouch = gslc_ElemGetTouchFunc(pGui,pElemTracked);
 
       // Invoke the callback function
       if (pfuncXTouch != NULL) {
@@ -2411,7 +4667,7 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       // Since we are going to use the callback within the element
       // we need to ensure it is cached in RAM first
       pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      pfuncXTick = pElem->pfuncXTick;
+      pfuncXTick = gslc_ElemGetTickFunc(pGui,pElem);
 
       // Invoke the callback function
       if (pfuncXTick != NULL) {
@@ -2475,12 +4731,14 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // --------------------------------------------------------------------------
 
   // Handle any extended element types
-  // - If the pfuncXDraw callback is defined, then let the callback
-  //   function supersede all default handling here
+  // - If the pfuncXDraw callback is defined (for the element or its
+  //   type), then let the callback function supersede all default
+  //   handling here
   // - Note that the end of the callback function is expected
   //   to clear the redraw flag
-  if (pElem->pfuncXDraw != NULL) {
-    (*pElem->pfuncXDraw)((void*)(pGui),(void*)(pElemRef),eRedraw);
+  GSLC_CB_DRAW  pfuncXDraw = gslc_ElemGetDrawFunc(pGui,pElem);
+  if (pfuncXDraw != NULL) {
+    (*pfuncXDraw)((void*)(pGui),(void*)(pElemRef),eRedraw);
     return true;
   }
 
@@ -2488,10 +4746,12 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // Init for default drawing
   // --------------------------------------------------------------------------
 
-  bool      bGlowEn,bGlowing,bGlowNow;
-  int16_t   nElemX,nElemY;
-  uint16_t  nElemW,nElemH;
+  bool          bGlowEn,bGlowing,bGlowNow;
+  int16_t       nElemX,nElemY;
+  uint16_t      nElemW,nElemH;
+  gslc_tsStyle  sStyle;
 
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
   nElemX    = pElem->rElem.x;
   nElemY    = pElem->rElem.y;
   nElemW    = pElem->rElem.w;
@@ -2518,11 +4778,11 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // - This also changes the fill color if selected and glow state is enabled
   if (pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN) {
     if (bGlowEn && bGlowing) {
-      colBg = pElem->colElemFillGlow;
-      gslc_DrawFillRect(pGui,rElemInner,pElem->colElemFillGlow);
+      colBg = sStyle.colFillGlow;
+      gslc_DrawFillRect(pGui,rElemInner,sStyle.colFillGlow);
     } else {
-      colBg = pElem->colElemFill;
-      gslc_DrawFillRect(pGui,rElemInner,pElem->colElemFill);
+      colBg = sStyle.colFill;
+      gslc_DrawFillRect(pGui,rElemInner,sStyle.colFill);
     }
   } else {
     // TODO: If unfilled, then we might need
@@ -2539,7 +4799,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_COL_GRAY_DK1);
   #else
   if (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) {
-    gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui,pElem->rElem,sStyle.colFrame);
   }
   #endif
 
@@ -2548,7 +4808,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // Handle special element types
   // --------------------------------------------------------------------------
   if (pElem->nType == GSLC_TYPE_LINE) {
-    gslc_DrawLine(pGui,nElemX,nElemY,nElemX+nElemW-1,nElemY+nElemH-1,pElem->colElemFill);
+    gslc_DrawLine(pGui,nElemX,nElemY,nElemX+nElemW-1,nElemY+nElemH-1,sStyle.colFill);
   }
 
 
@@ -2557,11 +4817,11 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // --------------------------------------------------------------------------
 
   // Draw any images associated with element
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    if ((bGlowEn && bGlowing) && (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) {
-      gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefGlow);
+  if (GSLC_ELEM_IMG_NORM(pElem).eImgFlags != GSLC_IMGREF_NONE) {
+    if ((bGlowEn && bGlowing) && (GSLC_ELEM_IMG_GLOW(pElem).eImgFlags != GSLC_IMGREF_NONE)) {
+      gslc_DrvDrawImage(pGui,nElemX,nElemY,GSLC_ELEM_IMG_GLOW(pElem));
     } else {
-      gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefNorm);
+      gslc_DrvDrawImage(pGui,nElemX,nElemY,GSLC_ELEM_IMG_NORM(pElem));
     }
   }
 
@@ -2579,10 +4839,10 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // Do we still want to render?
   if (bRenderTxt) {
 #if (DRV_HAS_DRAW_TEXT)
-    int16_t       nMargin   = pElem->nTxtMargin;
+    int16_t       nMargin   = sStyle.nTxtMargin;
 
     // Determine the text color
-    gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
+    gslc_tsColor  colTxt    = (bGlowNow)? sStyle.colTextGlow : sStyle.colText;
 
 
     // Determine if GUIslice or driver should perform text alignment
@@ -2604,7 +4864,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     int16_t nX1 = nX0 + nElemW - 2*nMargin;
     int16_t nY1 = nY0 + nElemH - 2*nMargin;
 
-    gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,pElem->eTxtAlign,pElem->pTxtFont,
+    gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,sStyle.eTxtAlign,sStyle.pTxtFont,
             pElem->pStrBuf,pElem->eTxtFlags,colTxt,colBg);
 
 #else // DRV_OVERRIDE_TXT_ALIGN
@@ -2625,19 +4885,19 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     //       for each text row would need to be performed.
     int16_t       nTxtOffsetX,nTxtOffsetY;
     uint16_t      nTxtSzW,nTxtSzH;
-    gslc_DrvGetTxtSize(pGui,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+    gslc_DrvGetTxtSize(pGui,sStyle.pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
 
     // Calculate the text alignment
     int16_t       nTxtX,nTxtY;
 
     // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
-    if      (pElem->eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMargin; }
-    else if (pElem->eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMargin-nTxtSzW; }
+    if      (sStyle.eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMargin; }
+    else if (sStyle.eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMargin-nTxtSzW; }
     else                                              { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
 
     // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
-    if      (pElem->eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMargin; }
-    else if (pElem->eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMargin-nTxtSzH; }
+    if      (sStyle.eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMargin; }
+    else if (sStyle.eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMargin-nTxtSzH; }
     else                                              { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
 
     // Now correct for offset from text bounds
@@ -2647,7 +4907,7 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     nTxtY -= nTxtOffsetY;
 
     // Call the driver text rendering routine
-    gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pElem->pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,colTxt,colBg);
+    gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,sStyle.pTxtFont,pElem->pStrBuf,pElem->eTxtFlags,colTxt,colBg);
 
 #endif // DRV_OVERRIDE_TXT_ALIGN
 
@@ -2709,9 +4969,12 @@ void gslc_ElemSetCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colF
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->colElemFrame     = colFrame;
-  pElem->colElemFill      = colFill;
-  pElem->colElemFillGlow  = colFillGlow;
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  sStyle.colFrame         = colFrame;
+  sStyle.colFill          = colFill;
+  sStyle.colFillGlow      = colFillGlow;
+  gslc_ElemStyleSet(pGui,pElem,&sStyle);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -2723,9 +4986,12 @@ void gslc_ElemSetGlowCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->colElemFrameGlow   = colFrameGlow;
-  pElem->colElemFillGlow    = colFillGlow;
-  pElem->colElemTextGlow    = colTxtGlow;
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  sStyle.colFrameGlow     = colFrameGlow;
+  sStyle.colFillGlow      = colFillGlow;
+  sStyle.colTextGlow      = colTxtGlow;
+  gslc_ElemStyleSet(pGui,pElem,&sStyle);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -2737,7 +5003,16 @@ void gslc_ElemSetGroup(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nGroupId)
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
+
+  // Move the element into the new group maintained by its element type
+  // (eg. the ring of radio buttons)
+  // - Elements that haven't been linked yet (eg. the temporary element
+  //   of a compound element) are linked when added to a collection
+  bool          bLinked = gslc_ElemTypeLink(pGui,NULL,pElemRef,false);
   pElem->nGroup           = nGroupId;
+  if (bLinked) {
+    gslc_ElemTypeLink(pGui,NULL,pElemRef,true);
+  }
 }
 
 int gslc_ElemGetGroup(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
@@ -2760,7 +5035,10 @@ void gslc_ElemSetTxtAlign(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nAl
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->eTxtAlign        = nAlign;
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  sStyle.eTxtAlign        = nAlign;
+  gslc_ElemStyleSet(pGui,pElem,&sStyle);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -2772,7 +5050,10 @@ void gslc_ElemSetTxtMargin(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nM
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->nTxtMargin        = nMargin;
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  sStyle.nTxtMargin       = nMargin;
+  gslc_ElemStyleSet(pGui,pElem,&sStyle);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -2792,6 +5073,19 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
     return;
   }
 
+#if (GSLC_STR_ARENA)
+  // Move the string into a larger block of the string arena if needed
+  // - If the arena is full, the string is truncated to the current block
+  size_t nLen = strlen(pStr)+1;
+  if (nLen > pElem->nStrBufMax) {
+    char* pStrBufOld = pElem->pStrBuf;
+    if (gslc_StrArenaAlloc(pGui,pElem,nLen,true)) {
+      strcpy(pElem->pStrBuf,pStrBufOld);
+      gslc_StrArenaFree(pGui,pStrBufOld);
+    }
+  }
+#endif
+
   // To avoid unnecessary redraw / flicker, only a change in
   // the text content will drive a redraw
 
@@ -2810,10 +5104,13 @@ void gslc_ElemSetTxtCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor c
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  if (!gslc_ColorEqual(pElem->colElemText, colVal) ||
-      !gslc_ColorEqual(pElem->colElemTextGlow, colVal)) {
-    pElem->colElemText      = colVal;
-    pElem->colElemTextGlow  = colVal; // Default to same color for glowing state
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  if (!gslc_ColorEqual(sStyle.colText, colVal) ||
+      !gslc_ColorEqual(sStyle.colTextGlow, colVal)) {
+    sStyle.colText          = colVal;
+    sStyle.colTextGlow      = colVal; // Default to same color for glowing state
+    gslc_ElemStyleSet(pGui,pElem,&sStyle);
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
   }
 }
@@ -2860,7 +5157,10 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
     return;
   }
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElem,&sStyle);
+  sStyle.pTxtFont = gslc_FontGet(pGui,nFontId);
+  gslc_ElemStyleSet(pGui,pElem,&sStyle);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -2875,6 +5175,7 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
 
   // Update the redraw flag
   gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+  gslc_teElemRefFlags eFlagsOld = eFlags;
   switch (eRedraw) {
     case GSLC_REDRAW_NONE:
       eFlags = (eFlags & ~GSLC_ELEMREF_REDRAW_MASK) | GSLC_ELEMREF_REDRAW_NONE;
@@ -2893,7 +5194,7 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   //   but an incremental redraw has been requested. In that
   //   case we leave the full redraw request pending.
   if (eRedraw == GSLC_REDRAW_INC) {
-    if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_FULL) {
+    if ((eFlagsOld & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_FULL) {
       // Don't update redraw state; leave it as full redraw pending
     } else {
       pElemRef->eElemFlags = eFlags;
@@ -2902,19 +5203,37 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     pElemRef->eElemFlags = eFlags;
   }
 
+  // A change to a static element means that any static layer
+  // that includes it is out of date
+  if ((eRedraw != GSLC_REDRAW_NONE) && (eFlags & GSLC_ELEMREF_STATIC)) {
+    gslc_PageStaticLayerReset(pGui);
+  }
+
+  // Likewise for any pre-rendered page that includes it
+  if (eRedraw != GSLC_REDRAW_NONE) {
+    gslc_PagePrerenderReset(pGui,pElemRef);
+  }
+
 #if (GSLC_FEATURE_COMPOUND)
   // Now propagate up the element hierarchy
   // (eg. in case of compound elements)
-
-  // TODO: Perhaps we need to qualify this with bRedraw=true?
-  // - ie. we only want to invalidate the parent element
-  //   containers, but we don't want to reset their status
-
   // - This functionality is only used in the case of compound
   //   elements (eg. XSelNum).
+  // - We only want to invalidate the parent element containers,
+  //   but we don't want to reset their status. Therefore clearing
+  //   a sub-element's redraw state is not propagated.
+  // - The parent is only marked for incremental redraw, which
+  //   indicates that one or more of its sub-elements are dirty
+  //   and can be redrawn on their own. The exception is a
+  //   transparent sub-element, which depends upon the parent
+  //   to redraw the background behind it.
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  if (pElem->pElemRefParent != NULL) {
-    gslc_ElemSetRedraw(pGui,pElem->pElemRefParent,eRedraw);
+  if ((pElem->pElemRefParent != NULL) && (eRedraw != GSLC_REDRAW_NONE)) {
+    if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
+      gslc_ElemSetRedraw(pGui,pElem->pElemRefParent,GSLC_REDRAW_FULL);
+    } else {
+      gslc_ElemSetRedraw(pGui,pElem->pElemRefParent,GSLC_REDRAW_INC);
+    }
   }
 #endif
 }
@@ -2976,37 +5295,53 @@ void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible
   bool bVisibleOld = gslc_ElemGetVisible(pGui,pElemRef);
   gslc_SetElemRefFlag(pGui,pElemRef,GSLC_ELEMREF_VISIBLE,(bVisible)?GSLC_ELEMREF_VISIBLE:0);
 
-  // Mark the element as needing redraw if its visibility status changed
-  if (bVisible != bVisibleOld) {
-    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  if (bVisible == bVisibleOld) {
+    return;
   }
 
-  // Request page redraw if element is becoming hidden
-  // - Determine minimum page redraw required to display
-  //   background that may be revealed behind hidden element
-  if ((!bVisible) && (bVisibleOld)) {
-    // Current method: Force redraw now with clipping active
-
-    // TODO: Enable deferred PageRedrawGo() by saving clip
-    //       region for later and/or mark which element is
-    //       being hidden.
+  if (bVisible) {
+    // Mark the element as needing redraw
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  } else {
+    // Element is becoming hidden
+    // - Defer the redraw of the region revealed behind the element
+    //   until the next gslc_Update(). At that point only the elements
+    //   that intersect the region and aren't obscured by an opaque
+    //   element with a higher Z-index are redrawn, and hiding multiple
+    //   elements results in a single redraw.
+    // - Any pending redraw of the hidden element itself is dropped
+    gslc_SetElemRefFlag(pGui,pElemRef,GSLC_ELEMREF_REDRAW_MASK,GSLC_ELEMREF_REDRAW_NONE);
+    gslc_tsElem* pElem = gslc_GetElemFromRef(pGui, pElemRef);
+    gslc_InvalidateRgnAdd(pGui, pElem->rElem);
+    if (gslc_ElemGetStatic(pGui,pElemRef)) {
+      gslc_PageStaticLayerReset(pGui);
+    }
+    gslc_PagePrerenderReset(pGui,pElemRef);
+  }
+}
 
-    // TODO: When deferring PageRedrawGo(), we can also support
-    //       more intelligent redraw calculations that will
-    //       only attempt to redraw elements that are not
-    //       either a) fully outside of the clipping rect or
-    //       b) elements that are fully obscured by elements
-    //       with a higher Z-index. Doing so should speed up
-    //       redraw during the element-hide operation and
-    //       avoid the overdrawing behavior.
+void gslc_ElemSetStatic(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bStatic)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemSetStatic";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (gslc_ElemGetStatic(pGui,pElemRef) == bStatic) {
+    return;
+  }
+  gslc_SetElemRefFlag(pGui,pElemRef,GSLC_ELEMREF_STATIC,(bStatic)?GSLC_ELEMREF_STATIC:0);
+  gslc_PageStaticLayerReset(pGui);
+}
 
-    gslc_tsElem* pElem = gslc_GetElemFromRef(pGui, pElemRef);
-    gslc_tsRect rRect = pElem->rElem;
-    gslc_SetClipRect(pGui, &rRect);
-    gslc_PageRedrawSet(pGui, true);
-    gslc_PageRedrawGo(pGui);
-    gslc_SetClipRect(pGui, NULL);
+bool gslc_ElemGetStatic(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemGetStatic";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
   }
+  return gslc_GetElemRefFlag(pGui,pElemRef,GSLC_ELEMREF_STATIC);
 }
 
 bool gslc_ElemGetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
@@ -3080,13 +5415,19 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   // rElem
   pElemDest->nGroup           = pElemSrc->nGroup;
   pElemDest->nFeatures        = pElemSrc->nFeatures;
-  pElemDest->sImgRefNorm      = pElemSrc->sImgRefNorm;
-  pElemDest->sImgRefGlow      = pElemSrc->sImgRefGlow;
+  // Only allocate storage for the image references if required
+  if ((GSLC_ELEM_IMG_NORM(pElemSrc).eImgFlags != GSLC_IMGREF_NONE) ||
+      (GSLC_ELEM_IMG_NORM(pElemDest).eImgFlags != GSLC_IMGREF_NONE)) {
+    if (gslc_ElemImgRefAlloc(pGui,pElemDest)) {
+      GSLC_ELEM_IMG_NORM_W(pElemDest) = GSLC_ELEM_IMG_NORM(pElemSrc);
+      GSLC_ELEM_IMG_GLOW_W(pElemDest) = GSLC_ELEM_IMG_GLOW(pElemSrc);
+    }
+  }
 
-  pElemDest->colElemFill      = pElemSrc->colElemFill;
-  pElemDest->colElemFillGlow  = pElemSrc->colElemFillGlow;
-  pElemDest->colElemFrame     = pElemSrc->colElemFrame;
-  pElemDest->colElemFrameGlow = pElemSrc->colElemFrameGlow;
+  // Colors and text format
+  gslc_tsStyle  sStyle;
+  gslc_ElemStyleGet(pGui,pElemSrc,&sStyle);
+  gslc_ElemStyleSet(pGui,pElemDest,&sStyle);
 
   // eRedraw
 #ifdef GLSC_COMPOUND
@@ -3099,36 +5440,16 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   //  nStrMax
   //  eTxtFlags
 
-  pElemDest->colElemText      = pElemSrc->colElemText;
-  pElemDest->colElemTextGlow  = pElemSrc->colElemTextGlow;
-  pElemDest->eTxtAlign        = pElemSrc->eTxtAlign;
-  pElemDest->nTxtMargin       = pElemSrc->nTxtMargin;
-  pElemDest->pTxtFont         = pElemSrc->pTxtFont;
-
   // pXData
 
-  //pElemDest->pfuncXEvent      = pElemSrc->pfuncXEvent; // UNUSED
-  pElemDest->pfuncXDraw       = pElemSrc->pfuncXDraw;
-  pElemDest->pfuncXTouch      = pElemSrc->pfuncXTouch;
-  pElemDest->pfuncXTick       = pElemSrc->pfuncXTick;
+  // Callbacks
+  gslc_tsElemType sElemCb;
+  gslc_ElemCbOvrGet(pGui,pElemSrc,&sElemCb);
+  gslc_ElemCbOvrSet(pGui,pElemDest,&sElemCb);
 
   gslc_ElemSetRedraw(pGui,pElemRefDest,GSLC_REDRAW_FULL);
 }
 
-/* UNUSED
-void gslc_ElemSetEventFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_EVENT funcCb)
-{
-  if ((pElemRef == NULL) || (funcCb == NULL)) {;
-    static const char GSLC_PMEM FUNCSTR[] = "ElemSetEventFunc";
-    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return;
-  }
-  gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->pfuncXEvent       = funcCb;
-}
-*/
-
-
 void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW funcCb)
 {
   if ((pElemRef == NULL) || (funcCb == NULL)) {
@@ -3136,8 +5457,13 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  gslc_tsElem* pElem    = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->pfuncXDraw     = funcCb;
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsElemType sElemCb;
+  gslc_ElemCbOvrGet(pGui,pElem,&sElemCb);
+  sElemCb.pfuncXDraw    = funcCb;
+  gslc_ElemCbOvrSet(pGui,pElem,&sElemCb);
+  // A custom drawing function may not paint the full element bounds
+  pElem->nFeatures     &= ~GSLC_ELEM_FEA_OPAQUE;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3148,8 +5474,82 @@ void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  gslc_tsElem* pElem      = gslc_GetElemFromRef(pGui,pElemRef);
-  pElem->pfuncXTick       = funcCb;
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsElemType sElemCb;
+  gslc_ElemCbOvrGet(pGui,pElem,&sElemCb);
+  sElemCb.pfuncXTick    = funcCb;
+  gslc_ElemCbOvrSet(pGui,pElem,&sElemCb);
+}
+
+bool gslc_ElemTypeRegister(gslc_tsGui* pGui,const gslc_tsElemType* pElemType)
+{
+  if ((pGui == NULL) || (pElemType == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemTypeRegister";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  int16_t nType;
+  #if (GSLC_USE_PROGMEM)
+  nType = pgm_read_word(&pElemType->nType);
+  #else
+  nType = pElemType->nType;
+  #endif
+  if ((nType < GSLC_TYPE_BASE_EXTEND) || (nType - GSLC_TYPE_BASE_EXTEND >= GSLC_ELEMTYPE_MAX)) {
+    GSLC_DEBUG_PRINT("ERROR: ElemTypeRegister() type (%d) outside of registry (max=%u)\n",
+      nType,GSLC_ELEMTYPE_MAX);
+    return false;
+  }
+  pGui->apElemType[nType - GSLC_TYPE_BASE_EXTEND] = pElemType;
+  return true;
+}
+
+gslc_tsElemRef* gslc_GroupRingGet(gslc_tsGui* pGui,int16_t nGroupId)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "GroupRingGet";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nGroupRingCnt;nInd++) {
+    if (pGui->asGroupRing[nInd].nGroup == nGroupId) {
+      return pGui->asGroupRing[nInd].pElemRef;
+    }
+  }
+  return NULL;
+}
+
+bool gslc_GroupRingSet(gslc_tsGui* pGui,int16_t nGroupId,gslc_tsElemRef* pElemRef)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "GroupRingSet";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nGroupRingCnt;nInd++) {
+    if (pGui->asGroupRing[nInd].nGroup == nGroupId) {
+      break;
+    }
+  }
+  if (pElemRef == NULL) {
+    // Release the entry by moving the last entry into its place
+    if (nInd < pGui->nGroupRingCnt) {
+      pGui->nGroupRingCnt--;
+      pGui->asGroupRing[nInd] = pGui->asGroupRing[pGui->nGroupRingCnt];
+    }
+    return true;
+  }
+  if (nInd >= GSLC_GROUP_RING_MAX) {
+    GSLC_DEBUG_PRINT("ERROR: GroupRingSet() too many groups (max=%u)\n",GSLC_GROUP_RING_MAX);
+    return false;
+  }
+  if (nInd == pGui->nGroupRingCnt) {
+    pGui->nGroupRingCnt++;
+  }
+  pGui->asGroupRing[nInd].nGroup    = nGroupId;
+  pGui->asGroupRing[nInd].pElemRef  = pElemRef;
+  return true;
 }
 
 bool gslc_ElemOwnsCoord(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nX,int16_t nY,bool bOnlyClickEn)
@@ -3737,7 +6137,8 @@ void gslc_SetTouchRemapYX(gslc_tsGui* pGui, bool bSwap)
 gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
   int16_t nType,gslc_tsRect rElem,char* pStrBuf,uint8_t nStrBufMax,int16_t nFontId)
 {
-  gslc_tsElem sElem;
+  gslc_tsElem   sElem;
+  gslc_tsStyle  sStyle;
   // Assign defaults to the element record
   gslc_ResetElem(&sElem);
 
@@ -3795,7 +6196,13 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
   sElem.nId             = nElemId;
   sElem.rElem           = rElem;
   sElem.nType           = nType;
-  sElem.pTxtFont        = gslc_FontGet(pGui,nFontId);
+  // The core element types paint their full bounds when filled
+  if (nType < GSLC_TYPE_BASE_EXTEND) {
+    sElem.nFeatures    |= GSLC_ELEM_FEA_OPAQUE;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.pTxtFont       = gslc_FontGet(pGui,nFontId);
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
 
   // Initialize the local string buffer (if enabled via GSLC_LOCAL_STR)
   // otherwise just save a copy of the external string buffer pointer
@@ -3814,7 +6221,17 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,
     sElem.nStrBufMax = 0;
     sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_NONE;
   } else {
-    #if (GSLC_LOCAL_STR)
+    #if (GSLC_STR_ARENA)
+      // Allocate just enough of the string arena to hold the string
+      // NOTE: Assume the string buffer pointer is located in RAM and not PROGMEM
+      if (gslc_StrArenaAlloc(pGui,&sElem,strlen(pStrBuf)+1,false)) {
+        strncpy(sElem.pStrBuf,pStrBuf,sElem.nStrBufMax-1);
+        sElem.pStrBuf[sElem.nStrBufMax-1] = '\0';  // Force termination
+        sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_INT;
+      } else {
+        sElem.eTxtFlags  = (sElem.eTxtFlags & ~GSLC_TXT_ALLOC) | GSLC_TXT_ALLOC_NONE;
+      }
+    #elif (GSLC_LOCAL_STR)
       // NOTE: Assume the string buffer pointer is located in RAM and not PROGMEM
       strncpy(sElem.pStrBuf,pStrBuf,GSLC_LOCAL_STR_LEN-1);
       sElem.pStrBuf[GSLC_LOCAL_STR_LEN-1] = '\0';  // Force termination
@@ -3883,6 +6300,10 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
 
     for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
       pElemRef = &(pCollect->asElemRef[nInd]);
+      if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+        // Removed element
+        continue;
+      }
 
       // Copy event so we can modify it in the loop
       gslc_tsEvent sEventNew = sEvent;
@@ -3909,6 +6330,57 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
 //   must be a static variable.
 // - When eFlags=GSLC_ELEMREF_SRC_CONST, the same is done as for
 //   GSLC_ELEMREF_SRC_PROG except that PROGMEM is not required to access.
+// Allocate a slot for an element stored in RAM
+// - Slots released by gslc_CollectElemRemove() are reused first, then
+//   the collection's element array and finally the shared element pool
+static gslc_tsElem* gslc_CollectElemAlloc(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  gslc_tsElem*  pElemSlot = NULL;
+  if (pCollect->nElemFree != GSLC_IND_NONE) {
+    pElemSlot = &(pCollect->asElem[pCollect->nElemFree]);
+    pCollect->nElemFree = pElemSlot->nId;
+  } else if (pCollect->nElemCnt < pCollect->nElemMax) {
+    pElemSlot = &(pCollect->asElem[pCollect->nElemCnt]);
+    pCollect->nElemCnt++;
+  } else if (pGui->nElemPoolFree != GSLC_IND_NONE) {
+    pElemSlot = &(pGui->asElemPool[pGui->nElemPoolFree]);
+    pGui->nElemPoolFree = pElemSlot->nId;
+  } else if (pGui->nElemPoolCnt < pGui->nElemPoolMax) {
+    pElemSlot = &(pGui->asElemPool[pGui->nElemPoolCnt]);
+    pGui->nElemPoolCnt++;
+  }
+  return pElemSlot;
+}
+
+// Close down an element stored in RAM and release its slot to the
+// free list of the collection or shared element pool that it came from
+// - The free list is linked through the nId of the free slots
+static void gslc_CollectElemFree(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsElem* pElemSlot)
+{
+  gslc_ElemDestruct(pElemSlot);
+  gslc_ElemImgRefFree(pGui,pElemSlot);
+#if (GSLC_STR_ARENA)
+  // Release the string buffer
+  // - Strings of the sub-elements in a compound element are not
+  //   released as the element has no destructor callback yet
+  gslc_StrArenaFree(pGui,pElemSlot->pStrBuf);
+#endif
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  // Release the element's shared style record
+  gslc_StyleRef(pGui,pElemSlot->nStyle,-1);
+#endif
+  gslc_ResetElem(pElemSlot);
+  if ((pCollect->asElem != NULL) && (pElemSlot >= pCollect->asElem) &&
+      (pElemSlot < pCollect->asElem + pCollect->nElemMax)) {
+    pElemSlot->nId = pCollect->nElemFree;
+    pCollect->nElemFree = (int16_t)(pElemSlot - pCollect->asElem);
+  } else if ((pGui->asElemPool != NULL) && (pElemSlot >= pGui->asElemPool) &&
+      (pElemSlot < pGui->asElemPool + pGui->nElemPoolMax)) {
+    pElemSlot->nId = pGui->nElemPoolFree;
+    pGui->nElemPoolFree = (int16_t)(pElemSlot - pGui->asElemPool);
+  }
+}
+
 gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,const gslc_tsElem* pElem,gslc_teElemRefFlags eFlags)
 {
   if ((pCollect == NULL) || (pElem == NULL)) {
@@ -3917,17 +6389,34 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     return NULL;
   }
 
-  if (pCollect->nElemRefCnt+1 > (pCollect->nElemRefMax)) {
+  // Find a slot in the element reference array
+  // - Reuse the first slot released by gslc_CollectElemRemove() (if any)
+  //   so that the remaining references don't move
+  uint16_t nElemRefInd = pCollect->nElemRefCnt;
+  if (pCollect->nElemRefFree > 0) {
+    for (nElemRefInd=0;nElemRefInd<pCollect->nElemRefCnt;nElemRefInd++) {
+      if (pCollect->asElemRef[nElemRefInd].eElemFlags == GSLC_ELEMREF_NONE) {
+        break;
+      }
+    }
+  } else if (pCollect->nElemRefCnt+1 > (pCollect->nElemRefMax)) {
     GSLC_DEBUG_PRINT("ERROR: CollectElemAdd() too many element references (max=%u) on ElemId=%u\n",
             pCollect->nElemRefMax,pElem->nId);
     // TODO: Implement a function that returns the current page's ID so that
     //       users can more easily identify the problematic page.
+    if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+#if (GSLC_STR_ARENA)
+      gslc_StrArenaFree(pGui,pElem->pStrBuf);
+#endif
+      gslc_ElemImgRefFree(pGui,(gslc_tsElem*)pElem);  // Typecast to drop const modifier
+    }
     return NULL;
   }
 
 
   // If the element is stored in RAM:
-  // - Copy the element into the internal RAM element array (asElem)
+  // - Copy the element into the internal RAM element array (asElem),
+  //   or the shared element pool if the array is full
   // - Create an entry in the element reference array (asElemRef) that points
   //   to the internal RAM element array.
   // - Since a copy has been made of the input element, the caller can
@@ -3945,46 +6434,104 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
           pCollect->nElemCnt+1,pCollect->nElemMax,pElem->nId);
   #endif
 
-  uint16_t nElemInd;
-  uint16_t nElemRefInd;
+  gslc_tsElem* pElemSlot;
   if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
 
     // Ensure we have enough space in internal element array
-    if (pCollect->nElemCnt+1 > (pCollect->nElemMax)) {
-      GSLC_DEBUG_PRINT("ERROR: CollectElemAdd() too many RAM elements (max=%u) on ElemId=%u\n",
-              pCollect->nElemMax,pElem->nId);
+    pElemSlot = gslc_CollectElemAlloc(pGui,pCollect);
+    if (pElemSlot == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: CollectElemAdd() too many RAM elements (max=%u, pool=%u) on ElemId=%u\n",
+              pCollect->nElemMax,pGui->nElemPoolMax,pElem->nId);
       // TODO: Implement a function that returns the current page's ID so that
       //       users can more easily identify the problematic page.
+#if (GSLC_STR_ARENA)
+      gslc_StrArenaFree(pGui,pElem->pStrBuf);
+#endif
+      gslc_ElemImgRefFree(pGui,(gslc_tsElem*)pElem);  // Typecast to drop const modifier
       return NULL;
     }
 
     // Copy the element to the internal array
     // - This performs a copy so that we can discard the element
     //   pointer after the call is complete
-    nElemInd = pCollect->nElemCnt;
-    pCollect->asElem[nElemInd] = *pElem;
-    pCollect->nElemCnt++;
-
-    // Add a reference
-    // - Pointer (pElem) links to an item of internal element array
-    nElemRefInd = pCollect->nElemRefCnt;
-    pCollect->asElemRef[nElemRefInd].eElemFlags = eFlags;
-    pCollect->asElemRef[nElemRefInd].pElem = &(pCollect->asElem[nElemInd]);
-    pCollect->nElemRefCnt++;
+    *pElemSlot = *pElem;
+#if (GSLC_STR_ARENA)
+    // The string buffer now belongs to the copy
+    gslc_StrArenaOwn(pGui,pElemSlot);
+#endif
 
   } else {
     // External reference
     // - Pointer (pElem) links to an element stored in FLASH (must be declared statically)
+    pElemSlot = (gslc_tsElem*)pElem;  // Typecast to drop const modifier
+  }
 
-    // Add a reference
-    nElemRefInd = pCollect->nElemRefCnt;
-    pCollect->asElemRef[nElemRefInd].eElemFlags = eFlags;
-    pCollect->asElemRef[nElemRefInd].pElem = (gslc_tsElem*)pElem;  // Typecast to drop const modifier
+  // Add a reference
+  // - Pointer (pElem) links to an item of internal element array or FLASH
+  pCollect->asElemRef[nElemRefInd].eElemFlags = eFlags;
+  pCollect->asElemRef[nElemRefInd].pElem = pElemSlot;
+  if (nElemRefInd == pCollect->nElemRefCnt) {
     pCollect->nElemRefCnt++;
+  } else {
+    pCollect->nElemRefFree--;
   }
 
+  // Let the element type link the new element (eg. into a radio group)
+  gslc_tsElemRef* pElemRefAdd = &(pCollect->asElemRef[nElemRefInd]);
+  gslc_ElemTypeLink(pGui,pCollect,pElemRefAdd,true);
+
   // Return the new element reference
-  return &(pCollect->asElemRef[nElemRefInd]);
+  return pElemRefAdd;
+}
+
+bool gslc_CollectElemRemove(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsElemRef* pElemRef)
+{
+  if ((pGui == NULL) || (pCollect == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "CollectElemRemove";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if ((pElemRef < pCollect->asElemRef) || (pElemRef >= pCollect->asElemRef + pCollect->nElemRefCnt) ||
+      (pElemRef->eElemFlags == GSLC_ELEMREF_NONE)) {
+    GSLC_DEBUG_PRINT("ERROR: CollectElemRemove(%s) element not in collection\n","");
+    return false;
+  }
+  int16_t nElemRefInd = (int16_t)(pElemRef - pCollect->asElemRef);
+
+  // Request redraw of the region revealed behind the element
+  gslc_ElemSetVisible(pGui,pElemRef,false);
+
+  // Let the element type unlink the element (eg. from a radio group)
+  gslc_ElemTypeLink(pGui,pCollect,pElemRef,false);
+
+  // Drop any touch tracking or input focus of the element
+  if (pCollect->pElemRefTracked == pElemRef) {
+    pCollect->pElemRefTracked = NULL;
+  }
+  if (pCollect->nElemIndFocused == nElemRefInd) {
+    pCollect->nElemIndFocused = GSLC_IND_NONE;
+  }
+
+  // Release the element slot (if in RAM)
+  if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_RAM) {
+    gslc_CollectElemFree(pGui,pCollect,pElemRef->pElem);
+  }
+
+  // The lookup tables of a const page table don't account for
+  // reused reference slots, so stop using them
+  pCollect->pPageConst  = NULL;
+
+  // Release the reference slot
+  // - Removed slots at the end of the array are dropped altogether
+  pElemRef->pElem       = NULL;
+  pElemRef->eElemFlags  = GSLC_ELEMREF_NONE;
+  pCollect->nElemRefFree++;
+  while ((pCollect->nElemRefCnt > 0) &&
+         (pCollect->asElemRef[pCollect->nElemRefCnt-1].eElemFlags == GSLC_ELEMREF_NONE)) {
+    pCollect->nElemRefCnt--;
+    pCollect->nElemRefFree--;
+  }
+  return true;
 }
 
 bool gslc_CollectGetRedraw(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
@@ -4041,21 +6588,62 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
 
   gslc_tsCollect* pCollect = &pPage->sCollect;
   gslc_tsElemRef* pElemRefAdd = gslc_CollectElemAdd(pGui,pCollect,pElem,eFlags);
+
+  // Any pre-rendered page that includes the new element is out of date
+  if (pElemRefAdd != NULL) {
+    gslc_PagePrerenderReset(pGui,pElemRefAdd);
+  }
   return pElemRefAdd;
 }
 
+bool gslc_ElemRemove(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemRef* pElemRef)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemRemove";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+
+  // Fetch the page containing the item
+  gslc_tsPage* pPage = gslc_PageFindById(pGui,nPageId);
+  if (pPage == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: ElemRemove() page (ID=%d) was not found\n",nPageId);
+    return false;
+  }
+
+  return gslc_CollectElemRemove(pGui,&pPage->sCollect,pElemRef);
+}
+
 bool gslc_SetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   // Update the drawing clip rectangle
   if (pRect == NULL) {
     // Set to full size of screen
+    pGui->bClipRectEn = false;
     return gslc_DrvSetClipRect(pGui,NULL);
   } else {
     // Set to user-specified region
+    pGui->bClipRectEn = true;
+    pGui->rClipRect   = *pRect;
     return gslc_DrvSetClipRect(pGui,pRect);
   }
 }
 
+bool gslc_GetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  if ((pGui == NULL) || (pRect == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "GetClipRect";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if (pGui->bClipRectEn) {
+    *pRect = pGui->rClipRect;
+  } else {
+    *pRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  }
+  return pGui->bClipRectEn;
+}
+
 
 void gslc_ElemSetImage(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsImgRef sImgRef,
   gslc_tsImgRef sImgRefSel)
@@ -4069,6 +6657,9 @@ void gslc_ElemSetImage(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsImgRef s
   gslc_tsElem*  pElem = gslc_GetElemFromRef(pGui,pElemRef);
 
   // Update the normal and glowing images
+  if (!gslc_ElemImgRefAlloc(pGui,pElem)) {
+    return;
+  }
   gslc_DrvSetElemImageNorm(pGui,pElem,sImgRef);
   gslc_DrvSetElemImageGlow(pGui,pElem,sImgRefSel);
 
@@ -4081,6 +6672,8 @@ bool gslc_SetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
   if (!gslc_DrvSetBkgndImage(pGui,sImgRef)) {
     return false;
   }
+  gslc_PageStaticLayerReset(pGui);
+  gslc_PagePrerenderReset(pGui,NULL);
   gslc_PageFlipSet(pGui,true);
   return true;
 }
@@ -4090,6 +6683,8 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
   if (!gslc_DrvSetBkgndColor(pGui,nCol)) {
     return false;
   }
+  gslc_PageStaticLayerReset(pGui);
+  gslc_PagePrerenderReset(pGui,NULL);
   gslc_PageFlipSet(pGui,true);
   return true;
 }
@@ -4136,31 +6731,41 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   pElem->nType            = GSLC_TYPE_BOX;
   pElem->nGroup           = GSLC_GROUP_ID_NONE;
   pElem->rElem            = (gslc_tsRect){0,0,0,0};
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  pElem->nStyle           = GSLC_STYLE_NONE;
+  pElem->pImgRef          = NULL;
+#else
   pElem->sImgRefNorm      = gslc_ResetImage();
   pElem->sImgRefGlow      = gslc_ResetImage();
   pElem->colElemFrame     = GSLC_COL_WHITE;
   pElem->colElemFill      = GSLC_COL_WHITE;
   pElem->colElemFrameGlow = GSLC_COL_WHITE;
   pElem->colElemFillGlow  = GSLC_COL_WHITE;
+#endif
   pElem->eTxtFlags        = GSLC_TXT_DEFAULT;
-  #if (GSLC_LOCAL_STR)
+  #if (GSLC_LOCAL_STR) && !(GSLC_STR_ARENA)
     pElem->pStrBuf[0]       = '\0';
     pElem->nStrBufMax       = 0;
   #else
     pElem->pStrBuf          = NULL;
     pElem->nStrBufMax       = 0;
   #endif
+#if !(GSLC_FEATURE_COMPACT_ELEM)
   pElem->colElemText      = GSLC_COL_WHITE;
   pElem->colElemTextGlow  = GSLC_COL_WHITE;
   pElem->eTxtAlign        = GSLC_ALIGN_MID_MID;
   pElem->nTxtMargin       = 0;
   pElem->pTxtFont         = NULL;
+#endif
 
   pElem->pXData           = NULL;
-  pElem->pfuncXEvent      = NULL; // UNUSED
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  pElem->nCbOvr           = GSLC_ELEM_CB_NONE;
+#else
   pElem->pfuncXDraw       = NULL;
   pElem->pfuncXTouch      = NULL;
   pElem->pfuncXTick       = NULL;
+#endif
 #if (GSLC_FEATURE_COMPOUND)
   pElem->pElemRefParent   = NULL;
 #endif
@@ -4190,13 +6795,13 @@ void gslc_ElemDestruct(gslc_tsElem* pElem)
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  if (pElem->sImgRefNorm.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  if (GSLC_ELEM_IMG_NORM(pElem).pvImgRaw != NULL) {
+    gslc_DrvImageDestruct(GSLC_ELEM_IMG_NORM(pElem).pvImgRaw);
+    GSLC_ELEM_IMG_NORM_W(pElem) = gslc_ResetImage();
   }
-  if (pElem->sImgRefGlow.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if (GSLC_ELEM_IMG_GLOW(pElem).pvImgRaw != NULL) {
+    gslc_DrvImageDestruct(GSLC_ELEM_IMG_GLOW(pElem).pvImgRaw);
+    GSLC_ELEM_IMG_GLOW_W(pElem) = gslc_ResetImage();
   }
 
   // TODO: Mark Element valid as false?
@@ -4222,16 +6827,30 @@ void gslc_CollectDestruct(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
   for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
     gslc_tsElemRef*     pElemRef = &pCollect->asElemRef[nInd];
     gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+    if (eFlags == GSLC_ELEMREF_NONE) {
+      // Slot released by gslc_CollectElemRemove()
+      continue;
+    }
+    // Let the element type unlink the element (eg. from a radio group)
+    gslc_ElemTypeLink(pGui,pCollect,pElemRef,false);
     // Only elements in RAM need destruction
     if ((eFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM) {
       continue;
     }
     // Fetch the element pointer from the reference array
+    // - Elements stored in the shared element pool are returned to it
     pElem = gslc_GetElemFromRef(pGui,pElemRef);
-    gslc_ElemDestruct(pElem);
+    gslc_CollectElemFree(pGui,pCollect,pElem);
+    pElemRef->pElem = NULL;
+    pElemRef->eElemFlags = GSLC_ELEMREF_NONE;
   }
   pCollect->nElemRefCnt = 0;
+  pCollect->nElemRefFree = 0;
+  pCollect->pPageConst = NULL;
   pCollect->nElemCnt = 0;
+  pCollect->nElemFree = GSLC_IND_NONE;
+  pCollect->pElemRefTracked = NULL;
+  pCollect->nElemIndFocused = GSLC_IND_NONE;
 
 }
 
@@ -4245,6 +6864,30 @@ void gslc_PageDestruct(gslc_tsGui* pGui,gslc_tsPage* pPage)
   }
   gslc_tsCollect* pCollect = &pPage->sCollect;
   gslc_CollectDestruct(pGui,pCollect);
+#if (GSLC_STR_ARENA)
+  // Reclaim the space released by the page's strings
+  gslc_StrArenaCompact(pGui);
+#endif
+#if (DRV_HAS_DRAW_LAYER)
+  gslc_DrvLayerDestroy(pGui,&pPage->pvStaticLayer);
+  gslc_DrvLayerDestroy(pGui,&pPage->pvPrerender);
+#endif
+  pPage->bStaticLayerValid = false;
+  pPage->bPrerenderValid = false;
+
+  // Release the page's extended data arena allocations along with
+  // any that were made after them
+  if (pPage->nXDataMark != GSLC_XDATA_MARK_NONE) {
+    uint32_t  nMark = pPage->nXDataMark;
+    uint8_t   nPageInd;
+    pGui->nXDataArenaUsed = nMark;
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      if ((pGui->asPage[nPageInd].nXDataMark != GSLC_XDATA_MARK_NONE) &&
+          (pGui->asPage[nPageInd].nXDataMark >= nMark)) {
+        pGui->asPage[nPageInd].nXDataMark = GSLC_XDATA_MARK_NONE;
+      }
+    }
+  }
 }
 
 // Close down all GUI members, including pages and fonts
@@ -4293,6 +6936,7 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
 
   pCollect->nElemMax          = nElemMax;
   pCollect->nElemCnt          = 0;
+  pCollect->nElemFree         = GSLC_IND_NONE;
 
   pCollect->nElemAutoIdNext   = GSLC_ID_AUTO_BASE;
 
@@ -4309,9 +6953,12 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Initialize element references
   pCollect->nElemRefMax = nElemRefMax;
   pCollect->nElemRefCnt = 0;
+  pCollect->nElemRefFree = 0;
   pCollect->asElemRef   = asElemRef;
-  for (nInd=0;nInd<nElemMax;nInd++) {
+  pCollect->pPageConst  = NULL;
+  for (nInd=0;nInd<nElemRefMax;nInd++) {
     (pCollect->asElemRef[nInd]).pElem = NULL;
+    (pCollect->asElemRef[nInd]).eElemFlags = GSLC_ELEMREF_NONE;
   }
 
   // Reset touch / input tracking
@@ -4410,9 +7057,34 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
     return NULL;
   }
 
-  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+  // Binary search the ID index of a const page table
+  // - Only the elements added after the table need a linear search
+  uint16_t          nIndStart = 0;
+  const gslc_tsPageConst* pPageConst = pCollect->pPageConst;
+  if ((pPageConst != NULL) && (pPageConst->asIdInd != NULL)) {
+    int16_t nLo = 0;
+    int16_t nHi = (int16_t)pPageConst->nElemRefCnt - 1;
+    while (nLo <= nHi) {
+      int16_t nMid = (int16_t)((nLo + nHi) / 2);
+      int16_t nMidId = pPageConst->asIdInd[nMid].nId;
+      if (nMidId == nElemId) {
+        return &(pCollect->asElemRef[pPageConst->asIdInd[nMid].nInd]);
+      } else if (nMidId < nElemId) {
+        nLo = nMid + 1;
+      } else {
+        nHi = nMid - 1;
+      }
+    }
+    nIndStart = pPageConst->nElemRefCnt;
+  }
+
+  for (nInd=nIndStart;nInd<pCollect->nElemRefCnt;nInd++) {
     // Fetch the element pointer from the reference array
     pElemRef = &(pCollect->asElemRef[nInd]);
+    if (pElemRef->eElemFlags == GSLC_ELEMREF_NONE) {
+      // Removed element
+      continue;
+    }
     pElem = gslc_GetElemFromRef(pGui,pElemRef);
 
     if (pElem->nId == nElemId) {
@@ -4454,7 +7126,31 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   gslc_tsElemRef*       pFoundElemRef = NULL;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
-  for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
+
+  // If the coordinate is covered by the hit-test buckets of a const
+  // page table, only the elements listed in its bucket (and any
+  // elements added after the table) need to be searched
+  const gslc_tsPageConst* pPageConst = pCollect->pPageConst;
+  const uint16_t*       pnBucketInd = NULL;
+  int16_t               nBucketCnt = 0;
+  int16_t               nIndMin = 0;
+  if ((pPageConst != NULL) && (pPageConst->nBucketW > 0) && (pPageConst->nBucketH > 0) &&
+      (nX >= 0) && (nY >= 0)) {
+    uint16_t nCol = (uint16_t)nX / pPageConst->nBucketW;
+    uint16_t nRow = (uint16_t)nY / pPageConst->nBucketH;
+    if ((nCol < pPageConst->nBucketCols) && (nRow < pPageConst->nBucketRows)) {
+      uint16_t nBucket = nRow * pPageConst->nBucketCols + nCol;
+      pnBucketInd = &(pPageConst->anBucketInd[pPageConst->anBucketStart[nBucket]]);
+      nBucketCnt  = (int16_t)(pPageConst->anBucketStart[nBucket+1] - pPageConst->anBucketStart[nBucket]);
+      nIndMin     = (int16_t)pPageConst->nElemRefCnt;
+    }
+  }
+
+  // Search the elements in decreasing Z-order. The elements of the
+  // const page table (if bucketed) are searched last via the bucket.
+  int16_t               nStep;
+  for (nStep=(int16_t)pCollect->nElemRefCnt-nIndMin+nBucketCnt-1;nStep>=0;nStep--) {
+    nInd = (nStep >= nBucketCnt)? (nStep-nBucketCnt+nIndMin) : (int16_t)pnBucketInd[nStep];
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
     if (!gslc_ElemGetVisible(pGui, pElemRef)) {
@@ -63,6 +63,79 @@ extern "C" {
   #define GSLC_PMEM
 #endif
 
+// Compact element layout
+// - Provide defaults for configurations that don't define the
+//   compact element options (see GSLC_FEATURE_COMPACT_ELEM)
+#if !defined(GSLC_FEATURE_COMPACT_ELEM)
+  #define GSLC_FEATURE_COMPACT_ELEM 0
+#endif
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  #if !defined(GSLC_STYLE_MAX)
+    #define GSLC_STYLE_MAX      16
+  #endif
+  #if !defined(GSLC_ELEM_IMG_MAX)
+    #define GSLC_ELEM_IMG_MAX   8
+  #endif
+  #if !defined(GSLC_ELEM_CB_MAX)
+    #define GSLC_ELEM_CB_MAX    16
+  #endif
+#endif
+
+// Element type registry
+// - Maximum number of extended element types (GSLC_TYPE_BASE_EXTEND+n)
+//   that can be registered with gslc_ElemTypeRegister()
+#if !defined(GSLC_ELEMTYPE_MAX)
+  #define GSLC_ELEMTYPE_MAX     16
+#endif
+
+// Element group rings
+// - Maximum number of element groups (eg. radio button groups) whose
+//   linked elements can be located through gslc_GroupRingGet()
+#if !defined(GSLC_GROUP_RING_MAX)
+  #define GSLC_GROUP_RING_MAX   8
+#endif
+
+// Occlusion culling
+// - Maximum number of opaque elements (starting from the top of the
+//   page stack) that are checked for covering the elements drawn
+//   before them during a redraw
+#if !defined(GSLC_REDRAW_OCCLUDE_MAX)
+  #define GSLC_REDRAW_OCCLUDE_MAX 8
+#endif
+
+// String arena
+// - Only applies to element local string storage (GSLC_LOCAL_STR=1)
+// - Element text is allocated from a GUI-level arena in one of
+//   GSLC_STR_CLASS_CNT size classes (8,16,32,64,128,255 bytes)
+#if !defined(GSLC_STR_ARENA) || !(GSLC_LOCAL_STR)
+  #undef  GSLC_STR_ARENA
+  #define GSLC_STR_ARENA        0
+#endif
+#if (GSLC_STR_ARENA)
+  #if !defined(GSLC_STR_ARENA_SIZE)
+    #define GSLC_STR_ARENA_SIZE 1024
+  #endif
+  #define GSLC_STR_CLASS_CNT    6
+#endif
+
+// Trigonometric lookup table
+// - With GSLC_TRIG_LUT_FULL=1, gslc_sinFX() / gslc_cosFX() use a
+//   full-resolution quarter-wave sine table (90*64+1 entries, approx
+//   11.5KB of RAM) that is generated on first use with the floating
+//   point library, instead of calling the library for every angle
+// - Requires GSLC_USE_FLOAT
+#if !defined(GSLC_TRIG_LUT_FULL) || !(GSLC_USE_FLOAT)
+  #undef  GSLC_TRIG_LUT_FULL
+  #define GSLC_TRIG_LUT_FULL    0
+#endif
+
+// Binary layout files
+// - Loading of binary layout files with gslc_LayoutLoad() requires
+//   memory-mapped file support (ie. LINUX)
+#if !defined(GSLC_FEATURE_LAYOUT)
+  #define GSLC_FEATURE_LAYOUT   0
+#endif
+
 
 
 // -----------------------------------------------------------------------
@@ -176,6 +249,7 @@ typedef enum {
 
 /// Element features type
 #define GSLC_ELEM_FEA_VALID     0x80      ///< Element record is valid
+#define GSLC_ELEM_FEA_OPAQUE    0x10      ///< Element paints its full bounds when filled
 #define GSLC_ELEM_FEA_CLICK_EN  0x08      ///< Element accepts touch presses
 #define GSLC_ELEM_FEA_GLOW_EN   0x04      ///< Element supports glowing state
 #define GSLC_ELEM_FEA_FRAME_EN  0x02      ///< Element is drawn with a frame
@@ -399,6 +473,8 @@ typedef enum {
   GSLC_ELEMREF_REDRAW_FULL = (1<<4),  ///< Full redraw of element requested
   GSLC_ELEMREF_REDRAW_INC  = (2<<4),  ///< Incremental redraw of element requested
 
+  GSLC_ELEMREF_STATIC      = (1<<2),  ///< Element content is static (cached in page's static layer)
+
   GSLC_ELEMREF_GLOWING     = (1<<6),  ///< Element state is glowing
   GSLC_ELEMREF_VISIBLE     = (1<<7),  ///< Element is currently shown (ie. visible)
 
@@ -483,6 +559,32 @@ typedef bool (*GSLC_CB_TOUCH)(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,in
 /// Callback function for element tick
 typedef bool (*GSLC_CB_TICK)(void* pvGui,void* pvElemRef);
 
+/// Callback function for linking an element with its collection
+/// - Called with bLink=true after the element has been added to a
+///   collection (pvCollect) and with bLink=false before it is removed
+///   from the collection or the collection is destructed
+/// - pvCollect may be NULL if the collection is not known
+/// - Returns true if the element was linked before the call
+typedef bool (*GSLC_CB_LINK)(void* pvGui,void* pvCollect,void* pvElemRef,bool bLink);
+
+/// Element type dispatch table
+/// - Provides the callbacks shared by all elements of an extended
+///   element type (see gslc_ElemTypeRegister). Any callback assigned
+///   to an individual element overrides the one in the table.
+/// - Also used to hold the per-element callback overrides in the
+///   compact element layout (GSLC_FEATURE_COMPACT_ELEM)
+typedef struct {
+  int16_t             nType;            ///< Element type enumeration (GSLC_TYPE_BASE_EXTEND+n)
+  GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing (or NULL)
+  GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch (or NULL)
+  GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick (or NULL)
+  GSLC_CB_LINK        pfuncXLink;       ///< Callback func ptr for collection add/remove (or NULL)
+                                        ///< - Not used for per-element callback overrides
+} gslc_tsElemType;
+
+/// Index of the callback override record for elements without overrides
+#define GSLC_ELEM_CB_NONE 0xFF
+
 /// Callback function for pin polling
 typedef bool (*GSLC_CB_PIN_POLL)(void* pvGui,int16_t* pnPinInd,int16_t* pnPinVal);
 
@@ -499,6 +601,14 @@ typedef struct gslc_tsRect {
   uint16_t  h;    ///< Height of region
 } gslc_tsRect;
 
+/// Opaque element that may cover elements drawn before it
+/// - Collected once per redraw (see gslc_PageRedrawOccluders)
+typedef struct {
+  gslc_tsRect rElem;        ///< Element region
+  int8_t      nStackPage;   ///< Page stack index of the element
+  int16_t     nElemInd;     ///< Index of the element in the page collection
+} gslc_tsOccluder;
+
 
 /// Define point coordinates
 typedef struct gslc_tsPt {
@@ -506,6 +616,14 @@ typedef struct gslc_tsPt {
   int16_t   y;        ///< Y coordinate
 } gslc_tsPt;
 
+/// Define a horizontal span of pixels
+/// - Used to batch the scanlines of filled shapes
+typedef struct gslc_tsSpan {
+  int16_t   nX;       ///< X coordinate of leftmost pixel
+  int16_t   nY;       ///< Y coordinate of row
+  uint16_t  nW;       ///< Width of span (pixels)
+} gslc_tsSpan;
+
 /// Color structure. Defines RGB triplet.
 typedef struct gslc_tsColor {
   uint8_t r;      ///< RGB red value
@@ -549,12 +667,40 @@ typedef struct {
 } gslc_tsImgRef;
 
 
+/// Element style record
+/// - Describes the appearance of an element (colors and text format)
+/// - In the compact element layout (GSLC_FEATURE_COMPACT_ELEM), elements
+///   reference a shared style record by index instead of holding these
+///   fields themselves
+typedef struct {
+  gslc_tsColor          colFrame;     ///< Color for frame
+  gslc_tsColor          colFill;      ///< Color for background fill
+  gslc_tsColor          colFrameGlow; ///< Color to use for frame when glowing
+  gslc_tsColor          colFillGlow;  ///< Color to use for fill when glowing
+  gslc_tsColor          colText;      ///< Color of overlay text
+  gslc_tsColor          colTextGlow;  ///< Color of overlay text when glowing
+  int8_t                eTxtAlign;    ///< Alignment of overlay text
+  uint8_t               nTxtMargin;   ///< Margin of overlay text within rect region
+  gslc_tsFont*          pTxtFont;     ///< Ptr to Font for overlay text
+} gslc_tsStyle;
+
+/// Style index for the default style record
+#define GSLC_STYLE_NONE   0xFF
+
+
 /// Element reference structure
 typedef struct {
   gslc_tsElem*          pElem;      ///< Pointer to element in memory [RAM,FLASH]
   gslc_teElemRefFlags   eElemFlags; ///< Element reference flags
 } gslc_tsElemRef;
 
+/// Element group ring
+/// - Locates the ring of linked elements (eg. radio buttons) in a group
+typedef struct {
+  int16_t               nGroup;     ///< Group ID
+  gslc_tsElemRef*       pElemRef;   ///< Any element in the group's ring
+} gslc_tsGroupRing;
+
 ///
 /// Element Struct
 /// - Represents a single graphic element in the GUIslice environment
@@ -569,11 +715,18 @@ typedef struct gslc_tsElem {
 
   int16_t             nId;              ///< Element ID specified by user
   uint8_t             nFeatures;        ///< Element feature vector (appearance/behavior))
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  uint8_t             nStyle;           ///< Index of shared style record (appearance)
+  uint8_t             nCbOvr;           ///< Index of callback override record (or GSLC_ELEM_CB_NONE)
+#endif
 
   int16_t             nType;            ///< Element type enumeration
   gslc_tsRect         rElem;            ///< Rect region containing element
   int16_t             nGroup;           ///< Group ID that the element belongs to
 
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  gslc_tsImgRef*      pImgRef;          ///< Ptr to image references (normal, glowing) or NULL
+#else
   gslc_tsColor        colElemFrame;     ///< Color for frame
   gslc_tsColor        colElemFill;      ///< Color for background fill
   gslc_tsColor        colElemFrameGlow; ///< Color to use for frame when glowing
@@ -581,6 +734,7 @@ typedef struct gslc_tsElem {
 
   gslc_tsImgRef       sImgRefNorm;      ///< Image reference to draw (normal)
   gslc_tsImgRef       sImgRefGlow;      ///< Image reference to draw (glowing)
+#endif
 
   // if (GSLC_FEATURE_COMPOUND)
   /// Parent element reference. Used during redraw
@@ -594,48 +748,206 @@ typedef struct gslc_tsElem {
   // endif
 
   // Text handling
-#if (GSLC_LOCAL_STR)
+#if (GSLC_LOCAL_STR) && !(GSLC_STR_ARENA)
   char                pStrBuf[GSLC_LOCAL_STR_LEN];  ///< Text string to overlay
 #else
-  char*               pStrBuf;          ///< Ptr to text string buffer to overlay
+  char*               pStrBuf;          ///< Ptr to text string buffer to overlay (string arena if GSLC_STR_ARENA)
 #endif
   uint8_t             nStrBufMax;       ///< Size of string buffer
   gslc_teTxtFlags     eTxtFlags;        ///< Flags associated with text buffer
 
-
+#if !(GSLC_FEATURE_COMPACT_ELEM)
   gslc_tsColor        colElemText;      ///< Color of overlay text
   gslc_tsColor        colElemTextGlow;  ///< Color of overlay text when glowing
   int8_t              eTxtAlign;        ///< Alignment of overlay text
   uint8_t             nTxtMargin;       ///< Margin of overlay text within rect region
   gslc_tsFont*        pTxtFont;         ///< Ptr to Font for overlay text
+#endif
 
   // Extended data elements
   void*               pXData;           ///< Ptr to extended data structure
 
   // Callback functions
-  GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for event tree (draw,touch,tick)
-
+  // - These override the callbacks of the element type (if registered)
+#if !(GSLC_FEATURE_COMPACT_ELEM)
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+#endif
 } gslc_tsElem;
 
+/// Element appearance accessors
+/// - Provide access to the appearance of an element independent of
+///   the element layout. In the compact element layout the colors and
+///   text format are fetched from the element's style record, and the
+///   image references are stored out-of-line.
+/// - The GSLC_ELEM_IMG_*() accessors are read-only. The image references
+///   may only be assigned through GSLC_ELEM_IMG_*_W() once they have
+///   been allocated (see gslc_ElemImgRefAlloc)
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  #define GSLC_ELEM_COL_FRAME(pGui,pElem)       (gslc_StyleGet(pGui,(pElem)->nStyle)->colFrame)
+  #define GSLC_ELEM_COL_FILL(pGui,pElem)        (gslc_StyleGet(pGui,(pElem)->nStyle)->colFill)
+  #define GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem)  (gslc_StyleGet(pGui,(pElem)->nStyle)->colFrameGlow)
+  #define GSLC_ELEM_COL_FILL_GLOW(pGui,pElem)   (gslc_StyleGet(pGui,(pElem)->nStyle)->colFillGlow)
+  #define GSLC_ELEM_COL_TEXT(pGui,pElem)        (gslc_StyleGet(pGui,(pElem)->nStyle)->colText)
+  #define GSLC_ELEM_COL_TEXT_GLOW(pGui,pElem)   (gslc_StyleGet(pGui,(pElem)->nStyle)->colTextGlow)
+  #define GSLC_ELEM_TXT_ALIGN(pGui,pElem)       (gslc_StyleGet(pGui,(pElem)->nStyle)->eTxtAlign)
+  #define GSLC_ELEM_TXT_MARGIN(pGui,pElem)      (gslc_StyleGet(pGui,(pElem)->nStyle)->nTxtMargin)
+  #define GSLC_ELEM_TXT_FONT(pGui,pElem)        (gslc_StyleGet(pGui,(pElem)->nStyle)->pTxtFont)
+  #define GSLC_ELEM_IMG_NORM(pElem)             (gslc_ElemGetImgRef(pElem)[0])
+  #define GSLC_ELEM_IMG_GLOW(pElem)             (gslc_ElemGetImgRef(pElem)[1])
+  #define GSLC_ELEM_IMG_NORM_W(pElem)           ((pElem)->pImgRef[0])
+  #define GSLC_ELEM_IMG_GLOW_W(pElem)           ((pElem)->pImgRef[1])
+#else
+  #define GSLC_ELEM_COL_FRAME(pGui,pElem)       ((pElem)->colElemFrame)
+  #define GSLC_ELEM_COL_FILL(pGui,pElem)        ((pElem)->colElemFill)
+  #define GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem)  ((pElem)->colElemFrameGlow)
+  #define GSLC_ELEM_COL_FILL_GLOW(pGui,pElem)   ((pElem)->colElemFillGlow)
+  #define GSLC_ELEM_COL_TEXT(pGui,pElem)        ((pElem)->colElemText)
+  #define GSLC_ELEM_COL_TEXT_GLOW(pGui,pElem)   ((pElem)->colElemTextGlow)
+  #define GSLC_ELEM_TXT_ALIGN(pGui,pElem)       ((pElem)->eTxtAlign)
+  #define GSLC_ELEM_TXT_MARGIN(pGui,pElem)      ((pElem)->nTxtMargin)
+  #define GSLC_ELEM_TXT_FONT(pGui,pElem)        ((pElem)->pTxtFont)
+  #define GSLC_ELEM_IMG_NORM(pElem)             ((pElem)->sImgRefNorm)
+  #define GSLC_ELEM_IMG_GLOW(pElem)             ((pElem)->sImgRefGlow)
+  #define GSLC_ELEM_IMG_NORM_W(pElem)           ((pElem)->sImgRefNorm)
+  #define GSLC_ELEM_IMG_GLOW_W(pElem)           ((pElem)->sImgRefGlow)
+#endif
+
+
 
 
+/// Element ID index entry
+/// - Used in the pre-sorted ID index of a const page table
+typedef struct {
+  int16_t               nId;              ///< Element ID
+  uint16_t              nInd;             ///< Index of element reference
+} gslc_tsElemIdInd;
+
+/// Const page table
+/// - Describes a page whose elements are fully defined at compile-time
+///   (eg. as generated by the GUIslice Builder) and that is added
+///   with gslc_PageAddConst(). No element construction is performed
+///   at startup: the elements remain in const storage and only the
+///   element references (ie. the redraw / visibility state) are in RAM.
+/// - All of the arrays may be located in const (FLASH) storage, but
+///   not in PROGMEM storage that requires special access.
+/// - asIdInd lists the element IDs in ascending order, enabling a
+///   binary search by ID
+/// - The hit-test buckets divide the region from (0,0) to
+///   (nBucketCols*nBucketW,nBucketRows*nBucketH) into a grid. Bucket
+///   (nCol + nRow*nBucketCols) lists the indices of the elements whose
+///   rect overlaps the grid cell, in increasing (ie. drawing) order, at
+///   anBucketInd[anBucketStart[nBucket] .. anBucketStart[nBucket+1]-1].
+///   Elements that don't accept touch (ie. without GSLC_ELEM_FEA_CLICK_EN)
+///   may be omitted from the buckets.
+typedef struct {
+  const gslc_tsElemRef*   asElemRef;      ///< Initial element references (into a const element array)
+  uint16_t                nElemRefCnt;    ///< Number of element references
+  const gslc_tsElemIdInd* asIdInd;        ///< Element IDs sorted in ascending order (or NULL)
+  uint16_t                nBucketW;       ///< Width of a hit-test bucket (or 0 for no buckets)
+  uint16_t                nBucketH;       ///< Height of a hit-test bucket
+  uint8_t                 nBucketCols;    ///< Number of hit-test bucket columns
+  uint8_t                 nBucketRows;    ///< Number of hit-test bucket rows
+  const uint16_t*         anBucketStart;  ///< Start of each bucket's list (nBucketCols*nBucketRows+1 entries)
+  const uint16_t*         anBucketInd;    ///< Element indices of all bucket lists
+} gslc_tsPageConst;
+
+
+#if (GSLC_FEATURE_LAYOUT)
+/// Binary layout file identifier ("GSLY")
+#define GSLC_LAYOUT_MAGIC     0x594C5347
+/// Binary layout file format version
+#define GSLC_LAYOUT_VERSION   1
+/// Offset value indicating that no string is present
+#define GSLC_LAYOUT_NONE      0xFFFFFFFF
+
+/// Binary layout flags
+#define GSLC_LAYOUT_FLAG_COMPACT    (1<<0)  ///< Elements use the compact element layout
+#define GSLC_LAYOUT_FLAG_LOCAL_STR  (1<<1)  ///< Element text is held inside the element
+
+/// Binary layout file header
+/// - A binary layout file (see gslc_LayoutSave) consists of:
+///   - Header
+///   - Page records (nPageCnt)
+///   - Style records (nStyleCnt), followed by the font ID of each
+///   - For each page: its element records followed by their fixup records
+///   - String table (element text and image filenames)
+/// - All offsets are from the start of the file. The element records
+///   are 8-byte aligned.
+/// - Element and style records are stored in the native gslc_tsElem
+///   and gslc_tsStyle layout with their pointers cleared, so a layout
+///   file can only be loaded by a build with the same element layout,
+///   configuration and architecture
+typedef struct {
+  uint32_t              nMagic;           ///< File identifier (GSLC_LAYOUT_MAGIC)
+  uint16_t              nVersion;         ///< File format version (GSLC_LAYOUT_VERSION)
+  uint16_t              nElemSize;        ///< Size of an element record (sizeof(gslc_tsElem))
+  uint16_t              nStyleSize;       ///< Size of a style record (sizeof(gslc_tsStyle))
+  uint8_t               nPtrSize;         ///< Size of a pointer
+  uint8_t               nFlags;           ///< Layout flags (GSLC_LAYOUT_FLAG_*)
+  uint16_t              nPageCnt;         ///< Number of page records
+  uint16_t              nStyleCnt;        ///< Number of style records
+  uint32_t              nPageOfs;         ///< Offset of the page records
+  uint32_t              nStyleOfs;        ///< Offset of the style records
+  uint32_t              nStrOfs;          ///< Offset of the string table
+  uint32_t              nSize;            ///< Total size of the file
+} gslc_tsLayoutHdr;
+
+/// Binary layout page record
+typedef struct {
+  int16_t               nPageId;          ///< Page ID that the elements are added to
+  uint16_t              nElemCnt;         ///< Number of elements on the page
+  uint32_t              nElemOfs;         ///< Offset of the element records
+  uint32_t              nFixOfs;          ///< Offset of the element fixup records
+} gslc_tsLayoutPage;
+
+/// Binary layout element fixup record
+/// - Describes how the pointers of an element record are restored on load
+typedef struct {
+  uint32_t              nStrOfs;          ///< Offset of the text in the string table (or GSLC_LAYOUT_NONE)
+  uint32_t              anImgOfs[2];      ///< Offset of the normal/glowing image filenames in the string table (or GSLC_LAYOUT_NONE)
+  uint16_t              aeImgFlags[2];    ///< Flags of the normal/glowing images
+  uint8_t               anCb[3];          ///< Index+1 of the draw/touch/tick callbacks in the callback table (or 0 for none)
+  uint8_t               eElemFlags;       ///< Element reference flags
+  int16_t               nFontId;          ///< Font ID of the text (or GSLC_FONT_NONE), unused in compact layout
+} gslc_tsLayoutElem;
+
+/// Handle to a loaded binary layout file
+typedef struct {
+  void*                 pvMap;            ///< Mapped file content (or NULL if none)
+  uint32_t              nSize;            ///< Size of the mapped file
+} gslc_tsLayout;
+#endif // GSLC_FEATURE_LAYOUT
+
 
 /// Element collection struct
 /// - Collections are used to maintain a list of elements and any
 ///   touch tracking status.
 /// - Pages and Compound Elements both instantiate a Collection
+/// - Elements can be removed with gslc_CollectElemRemove(). The slots
+///   of removed elements are reused by later additions:
+///   - Element references of the remaining elements never move, so
+///     pointers to them stay valid. The reference of a removed element
+///     becomes invalid and may be handed out again by a later addition,
+///     which then takes the removed element's position in the drawing order.
+///   - A removed reference slot is marked with GSLC_ELEMREF_NONE, so
+///     iteration over 0..nElemRefCnt-1 must skip such slots
+///   - Slots of the internal element array are kept on a free list
+///     (linked through the nId of the free slots)
 typedef struct {
   gslc_tsElem*          asElem;           ///< Array of elements
   uint16_t              nElemMax;         ///< Maximum number of elements to allocate (in RAM)
-  uint16_t              nElemCnt;         ///< Number of elements allocated
+  uint16_t              nElemCnt;         ///< Number of element array slots used (incl. free slots)
+  int16_t               nElemFree;        ///< First free element array slot (GSLC_IND_NONE for none)
   int16_t               nElemAutoIdNext;  ///< Next Element ID for auto-assignment
 
   gslc_tsElemRef*       asElemRef;        ///< Array of element references
   uint16_t              nElemRefMax;      ///< Maximum number of element references to allocate
-  uint16_t              nElemRefCnt;      ///< Number of element references allocated
+  uint16_t              nElemRefCnt;      ///< Number of element reference slots used (incl. removed slots)
+  uint16_t              nElemRefFree;     ///< Number of removed reference slots below nElemRefCnt
+
+  const gslc_tsPageConst* pPageConst;     ///< Const page table with lookup indices (or NULL)
 
   // Touch tracking
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
@@ -651,6 +963,9 @@ typedef struct {
 
 
 
+/// Value of gslc_tsPage::nXDataMark for a page without extended data arena allocations
+#define GSLC_XDATA_MARK_NONE  0xFFFFFFFF
+
 /// Page structure
 /// - A page contains a collection of elements
 /// - Many redraw functions operate at a page level
@@ -661,6 +976,21 @@ typedef struct {
 
   int16_t             nPageId;              ///< Page identifier
 
+  // Static layer cache
+  bool                bStaticLayerEn;       ///< Cache the page's static elements in an offscreen layer
+  bool                bStaticLayerValid;    ///< Static layer content is up to date
+  int16_t             nStaticLayerBase;     ///< Base page ID included in the static layer
+  void*               pvStaticLayer;        ///< Driver handle for the static layer (or NULL)
+
+  // Pre-rendered page
+  bool                bPrerenderValid;      ///< Pre-rendered page content is up to date
+  int16_t             nPrerenderBase;       ///< Base page ID included in the pre-rendered page
+  uint16_t            nPrerenderSeq;        ///< Sequence number of last use (for LRU eviction)
+  void*               pvPrerender;          ///< Driver handle for the pre-rendered page (or NULL)
+
+  // Extended data arena
+  uint32_t            nXDataMark;           ///< Arena level before the page's first allocation (GSLC_XDATA_MARK_NONE if none)
+
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;          ///< UNUSED: Callback func ptr for events
 
@@ -718,6 +1048,43 @@ typedef struct {
 
   gslc_tsElem         sElemTmpProg;     ///< Temporary element for Flash compatibility
 
+  gslc_tsElem*        asElemPool;       ///< Shared element pool used when a collection is full (or NULL)
+  uint16_t            nElemPoolMax;     ///< Maximum number of elements in the shared pool
+  uint16_t            nElemPoolCnt;     ///< Number of shared pool slots used (incl. free slots)
+  int16_t             nElemPoolFree;    ///< First free shared pool slot (GSLC_IND_NONE for none)
+
+  uint8_t*            pXDataArena;      ///< Arena for extended element data (or NULL)
+  uint32_t            nXDataArenaSize;  ///< Size of the extended data arena (bytes)
+  uint32_t            nXDataArenaUsed;  ///< Bytes allocated from the extended data arena
+  uint32_t            nXDataArenaPeak;  ///< High-water mark of the extended data arena
+
+  const gslc_tsStyle* asStyleConst;     ///< Table of constant style records (or NULL)
+  uint8_t             nStyleConstCnt;   ///< Number of constant style records
+  gslc_tsStyle        sStyleTmp;        ///< Temporary style record for Flash compatibility
+#if (GSLC_FEATURE_COMPACT_ELEM)
+  gslc_tsStyle        asStyle[GSLC_STYLE_MAX];    ///< Style records added at runtime
+  uint16_t            anStyleRef[GSLC_STYLE_MAX]; ///< Number of elements using each style record
+  uint8_t             nStyleCnt;        ///< Number of style records added at runtime
+  gslc_tsImgRef       asElemImgRef[2*GSLC_ELEM_IMG_MAX]; ///< Out-of-line element image references
+  uint8_t             nElemImgCnt;      ///< Number of element image reference pairs in use (high-water mark)
+  bool                abElemImgUsed[GSLC_ELEM_IMG_MAX]; ///< Image reference pair is allocated to an element
+  gslc_tsElemType     asElemCb[GSLC_ELEM_CB_MAX]; ///< Callback override records (shared by elements)
+  uint8_t             nElemCbCnt;       ///< Number of callback override records added
+#endif
+
+  const gslc_tsElemType* apElemType[GSLC_ELEMTYPE_MAX]; ///< Registered extended element types
+
+  gslc_tsGroupRing    asGroupRing[GSLC_GROUP_RING_MAX]; ///< Element rings of the linked groups
+  uint8_t             nGroupRingCnt;    ///< Number of group rings in use
+
+#if (GSLC_STR_ARENA)
+  uint8_t             acStrArena[GSLC_STR_ARENA_SIZE];    ///< String arena for element text
+  uint16_t            anStrArenaFree[GSLC_STR_CLASS_CNT]; ///< Free block list for each size class
+  uint16_t            nStrArenaTop;     ///< Offset of first unallocated byte in string arena
+  uint16_t            nStrArenaUsed;    ///< Bytes in use by allocated strings (incl. headers)
+  uint16_t            nStrArenaPeak;    ///< High-water mark of the string arena
+#endif
+
   gslc_teInitStat     eInitStatTouch;   ///< Status of touch initialization
   // TODO: exclude these in DRV_TOUCH_NONE
   int16_t             nTouchLastX;      ///< Last touch event X coord
@@ -740,6 +1107,9 @@ typedef struct {
 
   uint8_t             nFrameRateCnt;    ///< Diagnostic frame rate count
   uint8_t             nFrameRateStart;  ///< Diagnostic frame rate timestamp
+  uint16_t            nRedrawDrawCnt;   ///< Diagnostic count of elements drawn in last redraw
+  uint16_t            nRedrawCullCnt;   ///< Diagnostic count of elements culled in last redraw
+                                        ///< (fully covered by opaque elements above them)
 
 
   // Pages
@@ -751,15 +1121,28 @@ typedef struct {
   bool                abPageStackActive[GSLC_STACK__MAX]; ///< Whether page in stack can receive touch events
   bool                abPageStackDoDraw[GSLC_STACK__MAX]; ///< Whether page in stack is still actively drawn
 
+  // Popup save-under
+  bool                bPopupSaveUnderEn; ///< Save the display region under popups?
+  bool                bPopupSaveValid;   ///< Display region under current popup has been saved
+  gslc_tsRect         rPopupSave;        ///< Display region saved under current popup
+
+  uint8_t             nPrerenderMax;     ///< Maximum number of pre-rendered pages to keep
+  uint16_t            nPrerenderSeq;     ///< Sequence counter for pre-rendered page usage (LRU)
+
   // Redraw of screen (ie. across page stack)
   bool                bScreenNeedRedraw; ///< Screen requires a redraw
   bool                bScreenNeedFlip;   ///< Screen requires a page flip
+  bool                bInvalidateEn;     ///< A region of the screen has been invalidated
+  gslc_tsRect         rInvalidateRect;   ///< Bounding box of the invalidated screen region
+
+  // Drawing clip region
+  bool                bClipRectEn;       ///< A clipping rectangle is active
+  gslc_tsRect         rClipRect;         ///< Active clipping rectangle (if bClipRectEn)
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
   GSLC_CB_PIN_POLL    pfuncPinPoll;     ///< Callback func ptr for pin polling
 
-
   // Key/pin input control mapping
   gslc_tsInputMap*    asInputMap;       ///< Array of input maps
   uint8_t             nInputMapMax;     ///< Maximum number of input maps
@@ -919,6 +1302,50 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
 ///
 bool gslc_SetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
 
+///
+/// Get the current clipping rectangle
+/// - Allows a caller to restrict drawing temporarily and then
+///   restore the enclosing clip region afterwards
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pRect:       Pointer to Rect for the clip region (or the
+///                          entire screen if no clip region is active)
+///
+/// \return true if a clip region is active, false if entire screen
+///
+bool gslc_GetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+#if (GSLC_STR_ARENA)
+///
+/// Compact the string arena
+/// - Moves the element strings together so that the space released
+///   by destroyed elements can be reused by any size class
+/// - Called automatically by gslc_PageDestruct()
+/// - All elements with text must have been added to a page or
+///   collection before calling. The strings of any elements that
+///   were created but never added are released.
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_StrArenaCompact(gslc_tsGui* pGui);
+
+
+///
+/// Get the usage of the string arena
+/// - Can be used to size GSLC_STR_ARENA_SIZE for an application
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnUsed:      Bytes currently allocated (or NULL)
+/// \param[out] pnPeak:      High-water mark in bytes (or NULL)
+///
+/// \return none
+///
+void gslc_StrArenaGetUsage(gslc_tsGui* pGui,uint16_t* pnUsed,uint16_t* pnPeak);
+#endif // GSLC_STR_ARENA
+
 
 
 // ------------------------------------------------------------------------
@@ -1009,6 +1436,28 @@ bool gslc_ClipLine(gslc_tsRect* pClipRect,int16_t* pnX0,int16_t* pnY0,int16_t* p
 ///
 bool gslc_ClipRect(gslc_tsRect* pClipRect,gslc_tsRect* pRect);
 
+///
+/// Expand a rectangle so that it also covers another rectangle
+/// - An empty rectangle (zero width or height) is treated as
+///   covering no region
+///
+/// \param[inout] pRect:       Ptr to rectangle to expand
+/// \param[in]    rAddRect:    Rectangle to add to the region
+///
+/// \return none
+///
+void gslc_UnionRect(gslc_tsRect* pRect,gslc_tsRect rAddRect);
+
+///
+/// Determine if a rectangle is completely inside another rectangle
+///
+/// \param[in]  rInner:      Rectangle to test
+/// \param[in]  rOuter:      Rectangle to compare against
+///
+/// \return true if rInner is fully covered by rOuter, false otherwise
+///
+bool gslc_IsRectInRect(gslc_tsRect rInner,gslc_tsRect rOuter);
+
 
 ///
 /// Create an image reference to a bitmap file in LINUX filesystem
@@ -1069,10 +1518,25 @@ gslc_tsImgRef gslc_GetImageFromProg(const unsigned char* pImgBuf,gslc_teImgRefFl
 void gslc_PolarToXY(uint16_t nRad,int16_t n64Ang,int16_t* nDX,int16_t* nDY);
 
 
+///
+/// Convert an array of polar coordinates with the same radius to cartesian
+/// - Equivalent to calling gslc_PolarToXY() for each angle
+///
+/// \param[in]   nRad         Radius of rays
+/// \param[in]   an64Ang      Array of ray angles (in units of 1/64 degrees, 0 is up)
+/// \param[in]   nCnt         Number of angles in the array
+/// \param[out]  asPt         Array of X,Y offsets for the ray ends
+///
+/// \return none
+///
+void gslc_PolarToXYBatch(uint16_t nRad,const int16_t* an64Ang,uint16_t nCnt,gslc_tsPt* asPt);
+
+
 ///
 /// Calculate fixed-point sine function from fractional degrees
 /// - Depending on configuration, the result is derived from either
-///   floating point math library or fixed point lookup table.
+///   floating point math library or fixed point lookup table
+///   (see GSLC_TRIG_LUT_FULL).
 /// - gslc_sinFX(nAngDeg*64)/32768.0 = sin(nAngDeg*2pi/360)
 ///
 /// \param[in]   n64Ang       Angle (in units of 1/64 degrees)
@@ -1086,7 +1550,8 @@ int16_t gslc_sinFX(int16_t n64Ang);
 ///
 /// Calculate fixed-point cosine function from fractional degrees
 /// - Depending on configuration, the result is derived from either
-///   floating point math library or fixed point lookup table.
+///   floating point math library or fixed point lookup table
+///   (see GSLC_TRIG_LUT_FULL).
 /// - gslc_cosFX(nAngDeg*64)/32768.0 = cos(nAngDeg*2pi/360)
 ///
 /// \param[in]   n64Ang       Angle (in units of 1/64 degrees)
@@ -1245,6 +1710,39 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 ///
 void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
+///
+/// Draw a batch of filled horizontal spans
+/// - Used by the filled circle, triangle and quadrilateral
+///   rasterizers to output their scanlines
+/// - If the driver doesn't support span batches (DRV_HAS_DRAW_SPANS),
+///   each span is drawn as a filled rectangle of height 1
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans
+/// \param[in]  nSpanCnt:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return none
+///
+void gslc_DrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColor nCol);
+
+///
+/// Copy a rectangular region of the display to another location
+/// - Typically used to scroll content without redrawing it
+/// - The source and destination regions may overlap
+/// - Requires driver support (DRV_HAS_DRAW_RECT_COPY). If the
+///   driver doesn't support it, the caller should redraw the
+///   destination region instead.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Source region to copy
+/// \param[in]  nDstX:       Destination X coordinate (top-left)
+/// \param[in]  nDstY:       Destination Y coordinate (top-left)
+///
+/// \return true if the copy was performed, false if unsupported or error
+///
+bool gslc_DrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
 ///
 /// Draw a framed circle
 ///
@@ -1478,6 +1976,81 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal);
 void gslc_PopupHide(gslc_tsGui* pGui);
 
 
+///
+/// Enable save-under mode for popup dialogs
+/// - When enabled, gslc_PopupShow() saves the display region
+///   underneath the popup's elements and gslc_PopupHide() restores
+///   it, avoiding a redraw of the underlying pages. Elements on the
+///   underlying pages that changed while the popup was shown are
+///   redrawn afterwards.
+/// - Requires driver support (DRV_HAS_DRAW_RECT_SAVE) and partial
+///   redraw. Otherwise popups revert to a full page redraw.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  bSaveUnder:  True to enable save-under mode
+///
+/// \return none
+///
+void gslc_PopupSetSaveUnder(gslc_tsGui* pGui,bool bSaveUnder);
+
+
+///
+/// Enable the static layer cache for a page
+/// - When enabled, the background and the elements marked as static
+///   (see gslc_ElemSetStatic()) on the page and the base page are
+///   rendered once into an offscreen layer. Subsequent full redraws
+///   of the page (eg. on page change or popup dismissal) copy the layer
+///   to the display and only draw the remaining (dynamic) elements.
+/// - The layer is rebuilt after a static element is changed or the
+///   background is updated
+/// - Requires driver support (DRV_HAS_DRAW_LAYER). Otherwise the
+///   page is redrawn normally.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nPageId:     Page ID to configure
+/// \param[in]  bEn:         True to enable the static layer cache
+///
+/// \return none
+///
+void gslc_PageSetStaticLayer(gslc_tsGui* pGui,int16_t nPageId,bool bEn);
+
+
+///
+/// Pre-render a page into an offscreen layer
+/// - Intended to be called in idle time (eg. for the pages that
+///   are likely to be selected next). A later gslc_SetPageCur()
+///   to the page then presents it with a single copy rather than
+///   drawing each element.
+/// - Any pending redraw of the current page is completed first
+/// - The pre-rendered page includes the current base page and
+///   remains valid until one of its elements changes
+/// - At most the number of pages set by gslc_SetPrerenderMax() are
+///   kept; the least recently used page is released to make room
+/// - Requires driver support (DRV_HAS_DRAW_LAYER). Not performed
+///   while a popup is shown.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nPageId:     Page ID to pre-render
+///
+/// \return true if the page has been pre-rendered, false otherwise
+///
+bool gslc_PagePrerender(gslc_tsGui* pGui,int16_t nPageId);
+
+
+///
+/// Set the maximum number of pre-rendered pages to keep
+/// - Each pre-rendered page uses a display-sized offscreen layer
+/// - Pre-rendered pages exceeding the new limit are released,
+///   starting with the least recently used
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nMax:        Maximum number of pages (0 to disable)
+///
+/// \return none
+///
+void gslc_SetPrerenderMax(gslc_tsGui* pGui,uint8_t nMax);
+
+
 ///
 /// Update the need-redraw status for the current page
 ///
@@ -1499,6 +2072,31 @@ void gslc_PageRedrawSet(gslc_tsGui* pGui,bool bRedraw);
 bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 
 
+///
+/// Add a region of the screen that requires redraw
+/// - The region is redrawn during the next gslc_Update(). Only the
+///   elements that intersect the region (and that aren't covered by
+///   an opaque element above them) are redrawn.
+/// - Multiple regions are combined into their bounding box
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rAddRect:    Region of the screen to redraw
+///
+/// \return none
+///
+void gslc_InvalidateRgnAdd(gslc_tsGui* pGui,gslc_tsRect rAddRect);
+
+
+///
+/// Clear the region of the screen that requires redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_InvalidateRgnReset(gslc_tsGui* pGui);
+
+
 
 /// Add a page to the GUI
 /// - This call associates an element array with the collection within the page
@@ -1525,6 +2123,165 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t nMaxElem,
         gslc_tsElemRef* psElemRef,uint16_t nMaxElemRef);
 
+
+///
+/// Add a page defined by a const page table to the GUI
+/// - The elements of the table are referenced in place (no element
+///   construction is performed) and appear on the page in table order
+/// - The page's element reference array holds the mutable state of
+///   the elements (eg. redraw and visibility flags) and is initialized
+///   from the table's element references
+/// - The table's ID index and hit-test buckets accelerate element
+///   lookup by ID and by touch coordinate. They are no longer used
+///   once an element has been removed from the page.
+/// - Further elements may be added to the page in the normal manner,
+///   in which case they appear on top of the table's elements
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID to assign
+/// \param[in]  pPageConst:   Pointer to const page table
+/// \param[in]  psElem:       Internal element array storage for any elements
+///                           added later (or NULL if none)
+/// \param[in]  nMaxElem:     Maximum number of elements in the internal element array
+/// \param[in]  psElemRef:    Internal element reference array storage to
+///                           associate with the page. Must have space for
+///                           the table's element references plus any
+///                           elements added later.
+/// \param[in]  nMaxElemRef:  Maximum number of elements in the reference array
+///
+/// \return true if success, false otherwise
+///
+bool gslc_PageAddConst(gslc_tsGui* pGui,int16_t nPageId,const gslc_tsPageConst* pPageConst,
+        gslc_tsElem* psElem,uint16_t nMaxElem,gslc_tsElemRef* psElemRef,uint16_t nMaxElemRef);
+
+
+#if (GSLC_FEATURE_LAYOUT)
+///
+/// Save the elements of all pages to a binary layout file
+/// - The layout can then be loaded with gslc_LayoutLoad() instead
+///   of creating the elements at startup (eg. the code generated by
+///   the GUIslice Builder can be run once to export the layout)
+/// - The style table (see gslc_SetStyleTable) is saved as well. In the
+///   compact element layout this includes the style records added at runtime.
+/// - Element text is saved with its full buffer size, so it remains
+///   updatable after loading
+/// - Callbacks are saved by their position in the callback table
+/// - Elements with extended data (pXData) or images that are not
+///   sourced from a file can't be saved
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pFname:       Filename of the layout file to write
+/// \param[in]  asCb:         Callback table (or NULL if none)
+/// \param[in]  nCbCnt:       Number of entries in the callback table
+///
+/// \return true if success, false otherwise
+///
+bool gslc_LayoutSave(gslc_tsGui* pGui,const char* pFname,const gslc_tsElemType* asCb,uint8_t nCbCnt);
+
+
+///
+/// Load a binary layout file
+/// - The file is memory-mapped and its elements are added to the pages
+///   with GSLC_ELEMREF_SRC_CONST references into the mapped data, so
+///   the elements are not copied. The mapping is private, so any
+///   changes to the elements are not written back to the file.
+/// - The pages must have been added beforehand (eg. with gslc_PageAdd)
+///   with enough element references for the loaded elements. No
+///   internal element array is needed for them.
+/// - The fonts must have been added beforehand with their original IDs
+/// - The style table of the layout (if any) replaces the current one
+/// - The callback table must match the one used by gslc_LayoutSave()
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[out] pLayout:      Pointer to layout handle
+/// \param[in]  pFname:       Filename of the layout file to load
+/// \param[in]  asCb:         Callback table (or NULL if none)
+/// \param[in]  nCbCnt:       Number of entries in the callback table
+///
+/// \return true if success, false otherwise
+///
+bool gslc_LayoutLoad(gslc_tsGui* pGui,gslc_tsLayout* pLayout,const char* pFname,
+        const gslc_tsElemType* asCb,uint8_t nCbCnt);
+
+
+///
+/// Release a binary layout file loaded with gslc_LayoutLoad()
+/// - The loaded elements (and style table) must no longer be in use
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pLayout:      Pointer to layout handle
+///
+/// \return none
+///
+void gslc_LayoutUnload(gslc_tsGui* pGui,gslc_tsLayout* pLayout);
+#endif // GSLC_FEATURE_LAYOUT
+
+
+///
+/// Assign a shared element pool
+/// - Elements added to a page (or compound element) whose internal
+///   element array is full are stored in the shared pool instead. This
+///   allows pages that are built dynamically to be provisioned for their
+///   typical size rather than the worst case.
+/// - A page may also be added with no internal element array
+///   (psElem=NULL, nMaxElem=0), storing all of its RAM elements in the pool
+/// - Removed elements return their slot to the pool
+/// - Must be called before any elements are added
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  asElem:       Element array storage for the pool
+/// \param[in]  nElemMax:     Maximum number of elements in the pool
+///
+/// \return none
+///
+void gslc_SetElemPool(gslc_tsGui* pGui,gslc_tsElem* asElem,uint16_t nElemMax);
+
+
+///
+/// Assign an arena for extended element data
+/// - The gslc_ElemX*Create() functions allocate their extended data
+///   (pXData=NULL) and backing buffers (eg. pBuf=NULL) from the arena,
+///   instead of requiring the application to declare them statically
+/// - Allocations are made sequentially, so the data of each element
+///   is laid out contiguously in creation order
+/// - The allocations made for a page are released together when the
+///   page is destructed, along with any made after them (ie. pages
+///   should be destructed in the reverse order of their creation)
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pvArena:      Memory to use for the arena (or NULL for none)
+/// \param[in]  nArenaSize:   Size of the arena (bytes)
+///
+/// \return none
+///
+void gslc_SetXDataArena(gslc_tsGui* pGui,void* pvArena,uint32_t nArenaSize);
+
+
+///
+/// Allocate memory from the extended data arena
+/// - The memory is suitably aligned for any extended data structure
+///   and initialized to zero
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPage:        Page ID that owns the allocation (or GSLC_PAGE_NONE)
+/// \param[in]  nSize:        Number of bytes to allocate
+///
+/// \return Pointer to the allocated memory or NULL if the arena is full
+///
+void* gslc_XDataArenaAlloc(gslc_tsGui* pGui,int16_t nPage,uint32_t nSize);
+
+
+///
+/// Get the usage of the extended data arena
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnUsed:      Bytes currently allocated (or NULL)
+/// \param[out] pnPeak:      High-water mark in bytes (or NULL)
+///
+/// \return none
+///
+void gslc_XDataArenaGetUsage(gslc_tsGui* pGui,uint32_t* pnUsed,uint32_t* pnPeak);
+
 /// Find an element in the GUI by its Page ID and Element ID
 ///
 /// \param[in]  pGui:         Pointer to GUI
@@ -1738,6 +2495,8 @@ void gslc_ElemSetGlowCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor
 ///
 /// Set the group ID for an element
 /// - Typically used to associate radio button elements together
+/// - Elements within a compound element should be assigned their
+///   group before they are added to the compound element's collection
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
@@ -1904,73 +2663,141 @@ void gslc_ElemSetClickEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bClickEn
 ///
 void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsElemRef* pElemRefDest);
 
+
 ///
-/// Get the glowing enable for an element
+/// Assign a table of constant style records
+/// - The records can then be assigned to elements by index with
+///   gslc_ElemSetStyleId(), allowing a theme to be shared by many
+///   elements. In the compact element layout (GSLC_FEATURE_COMPACT_ELEM)
+///   the elements reference the records directly, otherwise the
+///   records are copied into the elements.
+/// - On devices that use PROGMEM (GSLC_USE_PROGMEM), the table must be
+///   declared in Flash (GSLC_PMEM)
+/// - Must be called before any element styles are assigned
 ///
 /// \param[in]  pGui:        Pointer to GUI
-/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  asStyle:     Array of style records (or NULL for none)
+/// \param[in]  nStyleCnt:   Number of style records in the array
 ///
-/// \return True if element supports glowing
+/// \return none
 ///
-bool gslc_ElemGetGlowEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+void gslc_SetStyleTable(gslc_tsGui* pGui,const gslc_tsStyle* asStyle,uint8_t nStyleCnt);
 
 
 ///
-/// Update the glowing indicator for an element
+/// Assign a style record from the constant style table to an element
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
-/// \param[in]  bGlowing:    True if element is glowing
+/// \param[in]  nStyleId:    Index of the style record in the style table
 ///
 /// \return none
 ///
-void gslc_ElemSetGlow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bGlowing);
+void gslc_ElemSetStyleId(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nStyleId);
+
 
 ///
-/// Get the glowing indicator for an element
+/// Assign the appearance of an element from a style record
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pStyle:      Pointer to style record
 ///
-/// \return True if element is glowing
+/// \return none
 ///
-bool gslc_ElemGetGlow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+void gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const gslc_tsStyle* pStyle);
+
 
 ///
-/// Update the visibility status for an element
+/// Get the appearance of an element as a style record
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
-/// \param[in]  bVisible:    True if element is shown, false if hidden
+/// \param[out] pStyle:      Pointer to style record to fill in
 ///
 /// \return none
 ///
-void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible);
+void gslc_ElemGetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsStyle* pStyle);
 
 ///
-/// Get the visibility status for an element
+/// Get the glowing enable for an element
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
 ///
-/// \return True if element is shown, false if hidden
+/// \return True if element supports glowing
 ///
-bool gslc_ElemGetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+bool gslc_ElemGetGlowEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
 
-/* UNUSED
 ///
-/// Assign the event callback function for a element
+/// Update the glowing indicator for an element
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
-/// \param[in]  funcCb:      Function pointer to event routine (or NULL for default))
+/// \param[in]  bGlowing:    True if element is glowing
 ///
 /// \return none
 ///
-void gslc_ElemSetEventFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_EVENT funcCb);
-*/
+void gslc_ElemSetGlow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bGlowing);
+
+///
+/// Get the glowing indicator for an element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return True if element is glowing
+///
+bool gslc_ElemGetGlow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Update the visibility status for an element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  bVisible:    True if element is shown, false if hidden
+///
+/// \return none
+///
+void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible);
+
+///
+/// Get the visibility status for an element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return True if element is shown, false if hidden
+///
+bool gslc_ElemGetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
 
 
+///
+/// Mark an element as static
+/// - A static element is expected to change rarely (eg. frames and
+///   labels) and is cached in the page's static layer if enabled
+///   (see gslc_PageSetStaticLayer())
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  bStatic:     True if element is static
+///
+/// \return none
+///
+void gslc_ElemSetStatic(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bStatic);
+
+
+///
+/// Get an element's static status
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return True if element is static
+///
+bool gslc_ElemGetStatic(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
 ///
 /// Assign the drawing callback function for an element
 /// - This allows the user to override the default rendering for
@@ -1998,6 +2825,50 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
 void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb);
 
 
+///
+/// Register the dispatch table of an extended element type
+/// - Elements of the type use the callbacks in the table unless
+///   a callback has been assigned to the individual element
+/// - The extended elements register their own type upon creation.
+///   Custom element types (or generated code) can register their
+///   tables once during initialization.
+/// - On devices that use PROGMEM (GSLC_USE_PROGMEM), the table must be
+///   declared in Flash (GSLC_PMEM)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemType:   Pointer to dispatch table (must be static)
+///
+/// \return true if success, false if the type can't be registered
+///
+bool gslc_ElemTypeRegister(gslc_tsGui* pGui,const gslc_tsElemType* pElemType);
+
+///
+/// Locate the ring of linked elements in a group
+/// - Used by element types that link the members of a group
+///   (eg. radio buttons) so that a group can be visited without
+///   searching the pages
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nGroupId:    Group ID
+///
+/// \return Pointer to an element in the group's ring or NULL if none
+///
+gslc_tsElemRef* gslc_GroupRingGet(gslc_tsGui* pGui,int16_t nGroupId);
+
+///
+/// Update the element that locates the ring of linked elements in a group
+/// - Up to GSLC_GROUP_RING_MAX groups can be tracked
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nGroupId:    Group ID
+/// \param[in]  pElemRef:    Pointer to an element in the group's ring
+///                          (or NULL once the ring is empty)
+///
+/// \return true if success, false if too many groups
+///
+bool gslc_GroupRingSet(gslc_tsGui* pGui,int16_t nGroupId,gslc_tsElemRef* pElemRef);
+
+
 ///
 /// Determine if a coordinate is inside of an element
 /// - This routine is useful in determining if a touch
@@ -2188,6 +3059,9 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
 // - These macros have to match the current definition and order of gslc_tsElem
 //   exactly, so any changes to the element definition must be reflected here
 //   as well.
+// - These macros are not available in the compact element layout
+//   (GSLC_FEATURE_COMPACT_ELEM) since the element appearance is then held
+//   in shared style records instead of the element itself.
 
 
 /// \def gslc_ElemCreateTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn)
@@ -2294,11 +3168,12 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
 ///
 
 
+#if !(GSLC_FEATURE_COMPACT_ELEM)
 #if (GSLC_USE_PROGMEM)
 
 #define gslc_ElemCreateTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
   static const char str##nElemId[] PROGMEM = strTxt;              \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
@@ -2322,14 +3197,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 
 #define gslc_ElemCreateTxt_P_R(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
@@ -2353,14 +3227,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 
 #define gslc_ElemCreateBox_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
@@ -2381,7 +3254,6 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       0,                                                          \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
       pfuncXDraw,                                                 \
       NULL,                                                       \
       pfuncXTick,                                                 \
@@ -2413,14 +3285,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateBtnTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,colFrameGlow,colFillGlow,nAlignTxt,bFrameEn,bFillEn,callFunc,extraData) \
   static const char str##nElemId[] PROGMEM = strTxt;              \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
@@ -2443,7 +3314,6 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       pFont,                                                      \
       (void*)extraData,                                           \
       NULL,                                                       \
-      NULL,                                                       \
       callFunc,                                                   \
       NULL,                                                       \
   };                                                              \
@@ -2451,7 +3321,7 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateBtnTxt_P_R(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colFrame,colFill,colFrameGlow,colFillGlow,nAlignTxt,bFrameEn,bFillEn,callFunc,extraData) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
@@ -2474,7 +3344,6 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       pFont,                                                      \
       (void*)extraData,                                           \
       NULL,                                                       \
-      NULL,                                                       \
       callFunc,                                                   \
       NULL,                                                       \
   };                                                              \
@@ -2487,7 +3356,7 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
 
 #define gslc_ElemCreateTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
   static const char str##nElemId[] = strTxt;                      \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
@@ -2511,14 +3380,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 
 #define gslc_ElemCreateTxt_P_R(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
@@ -2542,14 +3410,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 
 #define gslc_ElemCreateBox_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
@@ -2570,7 +3437,6 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       0,                                                          \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
       pfuncXDraw,                                                 \
       NULL,                                                       \
       pfuncXTick,                                                 \
@@ -2602,14 +3468,13 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
   };                                                              \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateBtnTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,colFrameGlow,colFillGlow,nAlignTxt,bFrameEn,bFillEn,callFunc,extraData) \
   static const char str##nElemId[] = strTxt;                      \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static const gslc_tsElem sElem##nElemId = {                     \
@@ -2632,7 +3497,6 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
       pFont,                                                      \
       (void*)extraData,                                           \
       NULL,                                                       \
-      NULL,                                                       \
       callFunc,                                                   \
       NULL,                                                       \
   };                                                              \
@@ -2641,6 +3505,120 @@ void gslc_InputMapAdd(gslc_tsGui* pGui,gslc_teInputRawEvent eInputEvent,int16_t
 
 
 #endif // GSLC_USE_PROGMEM
+#endif // !GSLC_FEATURE_COMPACT_ELEM
+
+
+// ------------------------------------------------------------------------
+// Const Page Table Initializers
+// ------------------------------------------------------------------------
+
+// - The following macros expand to the initializer of a const gslc_tsElem
+//   (or gslc_tsElemRef) for use in the element arrays of a const page
+//   table (see gslc_PageAddConst)
+// - As with the ElemCreate*_P() macros, these have to match the current
+//   definition and order of gslc_tsElem exactly
+// - These macros are not available in the compact element layout
+//   (GSLC_FEATURE_COMPACT_ELEM) nor with fixed element local string
+//   buffers (GSLC_LOCAL_STR without GSLC_STR_ARENA)
+
+/// \def GSLC_ELEMREF_CONST(asElem,nInd)
+/// Initializer for the element reference to a const page table element
+
+#define GSLC_ELEMREF_CONST(asElem,nInd) \
+  { (gslc_tsElem*)&(asElem)[nInd],                                \
+    (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL) }
+
+#if !(GSLC_FEATURE_COMPACT_ELEM) && !((GSLC_LOCAL_STR) && !(GSLC_STR_ARENA))
+
+/// \def GSLC_ELEM_CONST_BOX(nElemId,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick)
+/// Initializer for a const box element
+
+/// \def GSLC_ELEM_CONST_TXT(nElemId,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn)
+/// Initializer for a const text element
+
+/// \def GSLC_ELEM_CONST_BTNTXT(nElemId,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,colFrameGlow,colFillGlow,nAlignTxt,bFrameEn,bFillEn,callFunc,extraData)
+/// Initializer for a const text button element
+
+#define GSLC_ELEM_CONST_BOX(nElemId,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick) \
+  {                                                               \
+      nElemId,                                                    \
+      (uint8_t)(GSLC_ELEM_FEA_VALID |                             \
+        ((bFrameEn)?GSLC_ELEM_FEA_FRAME_EN:0) | ((bFillEn)?GSLC_ELEM_FEA_FILL_EN:0)), \
+      GSLC_TYPE_BOX,                                              \
+      {nX,nY,nW,nH},                                              \
+      GSLC_GROUP_ID_NONE,                                         \
+      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      NULL,                                                       \
+      NULL,                                                       \
+      0,                                                          \
+      GSLC_TXT_DEFAULT,                                           \
+      GSLC_COL_WHITE,                                             \
+      GSLC_COL_WHITE,                                             \
+      GSLC_ALIGN_MID_MID,                                         \
+      0,                                                          \
+      NULL,                                                       \
+      NULL,                                                       \
+      pfuncXDraw,                                                 \
+      NULL,                                                       \
+      pfuncXTick,                                                 \
+  }
+
+#define GSLC_ELEM_CONST_TXT(nElemId,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
+  {                                                               \
+      nElemId,                                                    \
+      (uint8_t)(GSLC_ELEM_FEA_VALID |                             \
+        ((bFrameEn)?GSLC_ELEM_FEA_FRAME_EN:0) | ((bFillEn)?GSLC_ELEM_FEA_FILL_EN:0)), \
+      GSLC_TYPE_TXT,                                              \
+      {nX,nY,nW,nH},                                              \
+      GSLC_GROUP_ID_NONE,                                         \
+      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      NULL,                                                       \
+      (char*)(strTxt),                                            \
+      0,                                                          \
+      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
+      colTxt,                                                     \
+      colTxt,                                                     \
+      nAlignTxt,                                                  \
+      0,                                                          \
+      pFont,                                                      \
+      NULL,                                                       \
+      NULL,                                                       \
+      NULL,                                                       \
+      NULL,                                                       \
+  }
+
+#define GSLC_ELEM_CONST_BTNTXT(nElemId,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,colFrameGlow,colFillGlow,nAlignTxt,bFrameEn,bFillEn,callFunc,extraData) \
+  {                                                               \
+      nElemId,                                                    \
+      (uint8_t)(GSLC_ELEM_FEA_VALID |                             \
+        GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |          \
+        ((bFrameEn)?GSLC_ELEM_FEA_FRAME_EN:0) | ((bFillEn)?GSLC_ELEM_FEA_FILL_EN:0)), \
+      GSLC_TYPE_BTN,                                              \
+      {nX,nY,nW,nH},                                              \
+      GSLC_GROUP_ID_NONE,                                         \
+      colFrame,colFill,colFrameGlow,colFillGlow,                  \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      {NULL,NULL,GSLC_IMGREF_NONE,NULL},                          \
+      NULL,                                                       \
+      (char*)(strTxt),                                            \
+      0,                                                          \
+      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
+      colTxt,                                                     \
+      colTxt,                                                     \
+      nAlignTxt,                                                  \
+      0,                                                          \
+      pFont,                                                      \
+      (void*)(extraData),                                         \
+      NULL,                                                       \
+      callFunc,                                                   \
+      NULL,                                                       \
+  }
+
+#endif // !GSLC_FEATURE_COMPACT_ELEM && !(GSLC_LOCAL_STR && !GSLC_STR_ARENA)
 
 
 
@@ -2715,6 +3693,22 @@ gslc_tsElem gslc_ElemCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPageId,int
 gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem,gslc_teElemRefFlags eFlags);
 
 
+///
+/// Remove an Element from a page
+/// - The region occupied by the element is redrawn on the next update
+/// - The element's slots are released for reuse by later additions.
+///   Other element references on the page remain valid, but pElemRef
+///   must no longer be used.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nPageId:     Page ID containing the element
+/// \param[in]  pElemRef:    Pointer to Element reference to remove
+///
+/// \return true if success, false if fail
+///
+bool gslc_ElemRemove(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElemRef* pElemRef);
+
+
 ///
 /// Get the flags associated with an element reference
 ///
@@ -2752,6 +3746,160 @@ void gslc_SetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlag
 gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
 
 
+///
+/// Get a style record by index
+/// - Indices below the size of the constant style table refer to the
+///   table (copied from FLASH to RAM if stored in PROGMEM), followed
+///   by the style records added at runtime
+/// - GSLC_STYLE_NONE (or any invalid index) returns the default style
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nStyleId:     Index of the style record
+///
+/// \return Pointer to the style record (read-only)
+///
+const gslc_tsStyle* gslc_StyleGet(gslc_tsGui* pGui,uint8_t nStyleId);
+
+
+///
+/// Copy the appearance of an element into a style record
+/// - Used when modifying the appearance of an element, in conjunction
+///   with gslc_ElemStyleSet()
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+/// \param[out] pStyle:       Pointer to style record to fill in
+///
+/// \return none
+///
+void gslc_ElemStyleGet(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsStyle* pStyle);
+
+
+///
+/// Assign the appearance of an element from a style record
+/// - In the compact element layout, the element references a matching
+///   shared style record, adding one if none exists yet
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+/// \param[in]  pStyle:       Pointer to style record
+///
+/// \return none
+///
+void gslc_ElemStyleSet(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsStyle* pStyle);
+
+
+///
+/// Ensure that an element has storage for its image references
+/// - Must be called before the image references are assigned
+/// - In the compact element layout, the image references are allocated
+///   from a pool of GSLC_ELEM_IMG_MAX entries
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return true if success, false if the pool is exhausted
+///
+bool gslc_ElemImgRefAlloc(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+
+///
+/// Release the storage for the image references of an element
+/// - Called when an element is removed from its collection
+/// - In the compact element layout, the image references are returned
+///   to the pool for reuse by gslc_ElemImgRefAlloc()
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return none
+///
+void gslc_ElemImgRefFree(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+
+///
+/// Copy the callbacks assigned to an individual element
+/// - Excludes the callbacks of the element type
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+/// \param[out] pElemCb:      Pointer to record to fill in (nType is unused)
+///
+/// \return none
+///
+void gslc_ElemCbOvrGet(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsElemType* pElemCb);
+
+
+///
+/// Assign the callbacks of an individual element
+/// - In the compact element layout, elements with the same callbacks
+///   share a record from a pool of GSLC_ELEM_CB_MAX entries. Records are
+///   not released, so the callbacks are expected to be assigned once
+///   during initialization.
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+/// \param[in]  pElemCb:      Pointer to callbacks to assign (nType is unused)
+///
+/// \return true if success, false if the pool is exhausted
+///
+bool gslc_ElemCbOvrSet(gslc_tsGui* pGui,gslc_tsElem* pElem,const gslc_tsElemType* pElemCb);
+
+
+///
+/// Get the drawing callback of an element
+/// - Returns the element's own callback if assigned, otherwise the
+///   callback of its registered element type
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return Callback function pointer or NULL if none
+///
+GSLC_CB_DRAW gslc_ElemGetDrawFunc(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+
+///
+/// Get the touch callback of an element
+/// - Returns the element's own callback if assigned, otherwise the
+///   callback of its registered element type
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return Callback function pointer or NULL if none
+///
+GSLC_CB_TOUCH gslc_ElemGetTouchFunc(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+
+///
+/// Get the tick callback of an element
+/// - Returns the element's own callback if assigned, otherwise the
+///   callback of its registered element type
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return Callback function pointer or NULL if none
+///
+GSLC_CB_TICK gslc_ElemGetTickFunc(gslc_tsGui* pGui,gslc_tsElem* pElem);
+
+
+#if (GSLC_FEATURE_COMPACT_ELEM)
+///
+/// Get the image references (normal, glowing) of an element
+/// - If the element has no image references allocated, a pair of
+///   empty image references is returned
+/// - The image references are read-only; see GSLC_ELEM_IMG_NORM_W()
+///
+/// \param[in]  pElem:        Pointer to Element
+///
+/// \return Pointer to the pair of image references
+///
+const gslc_tsImgRef* gslc_ElemGetImgRef(const gslc_tsElem* pElem);
+#endif
+
+
 ///
 /// Set an element to use a bitmap image
 ///
@@ -2828,6 +3976,10 @@ void gslc_PageSetEventFunc(gslc_tsGui* pGui,gslc_tsPage* pPage,GSLC_CB_EVENT fun
 /// elements that have been marked as needing redraw are
 /// rendered unless the entire page has been marked as
 /// needing redraw (in which case everything is drawn)
+/// - Elements that are completely covered by an opaque element
+///   higher in the page stack are skipped. The number of elements
+///   drawn and skipped is saved in nRedrawDrawCnt and nRedrawCullCnt
+///   (and reported when DBG_REDRAW is defined).
 ///
 /// \param[in]  pGui:        Pointer to GUI
 ///
@@ -2892,6 +4044,135 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// \internal
 void gslc_PageRedrawCalc(gslc_tsGui* pGui);
 
+/// Redraw the invalidated region of the screen
+/// - The background and the elements (across the page stack) that
+///   intersect the region are redrawn with clipping enabled
+/// - Elements that are completely covered within the region by an
+///   opaque element with a higher Z-index are skipped
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_PageRedrawRgn(gslc_tsGui* pGui);
+
+/// Collect the opaque elements that may cover other elements
+/// - Only visible elements with fill enabled whose type paints the
+///   full element bounds (GSLC_ELEM_FEA_OPAQUE) are treated as opaque
+/// - The elements are collected from the top of the page stack down,
+///   up to a maximum of GSLC_REDRAW_OCCLUDE_MAX, so that the cost of
+///   each gslc_PageRedrawOccluded() check remains bounded
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[out] asOccluder:   Array of GSLC_REDRAW_OCCLUDE_MAX records to fill in
+///
+/// \return Number of records filled in
+///
+/// \internal
+uint8_t gslc_PageRedrawOccluders(gslc_tsGui* pGui,gslc_tsOccluder* asOccluder);
+
+/// Determine if a region of an element is covered by an opaque
+/// element that is drawn after it (ie. with a higher Z-index),
+/// either later in the same page or on a page higher in the stack
+/// - Only the opaque elements collected by gslc_PageRedrawOccluders()
+///   are checked
+///
+/// \param[in]  asOccluder:   Array of opaque elements
+/// \param[in]  nOccluderCnt: Number of opaque elements in array
+/// \param[in]  nStackPage:   Page stack index of the element
+/// \param[in]  nElemInd:     Index of the element in the page collection
+/// \param[in]  rRegion:      Region of the element to test
+///
+/// \return true if the region is fully covered, false otherwise
+///
+/// \internal
+bool gslc_PageRedrawOccluded(const gslc_tsOccluder* asOccluder,uint8_t nOccluderCnt,
+  int8_t nStackPage,int16_t nElemInd,gslc_tsRect rRegion);
+
+/// Save the display region that will be covered by a popup page
+/// - Only performed if popup save-under mode is enabled and
+///   supported by the driver
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID of the popup
+///
+/// \return true if the region was saved, false otherwise
+///
+/// \internal
+bool gslc_PopupSave(gslc_tsGui* pGui,int16_t nPageId);
+
+/// Release any display region saved under the current popup
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_PopupSaveDiscard(gslc_tsGui* pGui);
+
+/// Draw the static layer of the current page
+/// - Copies the layer to the display if it is up to date, otherwise
+///   draws the background and static elements and captures them
+///   into the layer
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return true if the static elements have been drawn, false if
+///         the current page has no static layer
+///
+/// \internal
+bool gslc_PageStaticLayerDraw(gslc_tsGui* pGui);
+
+/// Get the current page if its static layer is up to date
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return Pointer to the current page or NULL if it has no valid static layer
+///
+/// \internal
+gslc_tsPage* gslc_PageStaticLayerGet(gslc_tsGui* pGui);
+
+/// Mark the static layers of all pages as out of date
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_PageStaticLayerReset(gslc_tsGui* pGui);
+
+/// Present the pre-rendered current page if it is up to date
+///
+/// \param[in]  pGui:         Pointer to GUI
+///
+/// \return true if the pre-rendered page has been copied to the display
+///
+/// \internal
+bool gslc_PagePrerenderDraw(gslc_tsGui* pGui);
+
+/// Mark the pre-rendered pages that include an element as out of date
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pElemRef:     Pointer to Element reference (or NULL for all pages)
+///
+/// \return none
+///
+/// \internal
+void gslc_PagePrerenderReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+/// Release pre-rendered pages, least recently used first, until
+/// no more than nMax remain (not counting pPageKeep)
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pPageKeep:    Page to exclude from release (or NULL)
+/// \param[in]  nMax:         Maximum number of pre-rendered pages to keep
+///
+/// \return none
+///
+/// \internal
+void gslc_PagePrerenderEvict(gslc_tsGui* pGui,gslc_tsPage* pPageKeep,uint8_t nMax);
+
 
 /// \todo Doc. This API is experimental and subject to change
 int16_t gslc_PageFocusStep(gslc_tsGui* pGui,gslc_tsPage* pPage,bool bNext);
@@ -2977,6 +4258,9 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
 /// - Note that the contents of pElem are copied to the collection's
 ///   element array so the pElem pointer can be discarded are the
 ///   call is complete.
+/// - Slots released by gslc_CollectElemRemove() are reused first. If the
+///   collection's element array is full, the element is stored in the
+///   shared element pool (if assigned by gslc_SetElemPool).
 ///
 /// \param[in]  pGui:         Pointer to GUI
 /// \param[in]  pCollect:     Pointer to the collection
@@ -2991,6 +4275,23 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
 gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,const gslc_tsElem* pElem,gslc_teElemRefFlags eFlags);
 
 
+///
+/// Remove an element from a collection
+/// - Releases the element reference slot and (for elements in RAM)
+///   the element array slot for reuse by gslc_CollectElemAdd()
+/// - The element reference is marked GSLC_ELEMREF_NONE. Removed slots
+///   at the end of the reference array are dropped from nElemRefCnt.
+/// - Sub-elements of a compound element are not released
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+/// \param[in]  pElemRef:     Ptr to the element reference to remove
+///
+/// \return true if success, false if the element is not in the collection
+///
+bool gslc_CollectElemRemove(gslc_tsGui* pGui,gslc_tsCollect* pCollect,gslc_tsElemRef* pElemRef);
+
+
 ///
 /// Determine if any elements in a collection need redraw
 ///
@@ -453,6 +453,8 @@ extern "C" {
   #define GSLC_FEATURE_XGAUGE_RAMP    0   // XGauge control with ramp support
   #define GSLC_FEATURE_XTEXTBOX_EMBED 0   // XTextbox control with embedded color
   #define GSLC_FEATURE_INPUT          0   // Keyboard / GPIO input control
+  #define GSLC_FEATURE_COMPACT_ELEM   0   // Compact element layout with shared style records
+  #define GSLC_FEATURE_LAYOUT         0   // Binary layout files (gslc_LayoutLoad), requires LINUX
 
 
   // Enable support for SD card
@@ -486,8 +488,13 @@ extern "C" {
   //   GSLC_LOCAL_STR_LEN defines the fixed length buffer used for every element
   #define GSLC_LOCAL_STR      0   // 1=Use local strings (in element array), 0=External
   #define GSLC_LOCAL_STR_LEN  30  // Max string length of text elements
+  // - With GSLC_STR_ARENA=1, local strings are instead allocated according
+  //   to their length from a shared arena of GSLC_STR_ARENA_SIZE bytes
+  #define GSLC_STR_ARENA      0   // 1=Allocate local strings from arena, 0=Fixed buffer
+  #define GSLC_STR_ARENA_SIZE 512 // Total size of the string arena (bytes)
 
   #define GSLC_USE_FLOAT      0   // 1=Use floating pt library, 0=Fixed-point lookup tables
+  #define GSLC_TRIG_LUT_FULL  0   // 1=Full-resolution sin lookup table (11.5KB RAM, requires GSLC_USE_FLOAT)
 
 
   // Debug diagnostic modes
@@ -495,6 +502,7 @@ extern "C" {
   //#define DBG_LOG           // Enable debugging log output
   //#define DBG_TOUCH         // Enable debugging of touch-presses
   //#define DBG_FRAME_RATE    // Enable diagnostic frame rate reporting
+  //#define DBG_REDRAW        // Enable diagnostic redraw (drawn / culled) reporting
   //#define DBG_DRAW_IMM      // Enable immediate rendering of drawing primitives
   //#define DBG_DRIVER        // Enable graphics driver debug reporting
 
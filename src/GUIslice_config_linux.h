@@ -74,6 +74,8 @@ extern "C" {
 #define GSLC_FEATURE_XGAUGE_RAMP    1   // XGauge control with ramp support
 #define GSLC_FEATURE_XTEXTBOX_EMBED 0   // XTextbox control with embedded color
 #define GSLC_FEATURE_INPUT          1   // Keyboard / GPIO input control
+#define GSLC_FEATURE_COMPACT_ELEM   0   // Compact element layout with shared style records
+#define GSLC_FEATURE_LAYOUT         1   // Binary layout files (gslc_LayoutLoad)
 
 // Error reporting
 // - Set DEBUG_ERR to 1 to enable error reporting via the console
@@ -163,12 +165,24 @@ extern "C" {
 // this defines the fixed length buffer used for every element
 #define GSLC_LOCAL_STR_LEN  30  // Max string length of text elements
 
+// When using element local string storage (GSLC_LOCAL_STR=1), the
+// string arena allocates each element's text from a shared pool of
+// GSLC_STR_ARENA_SIZE bytes according to its length, instead of
+// reserving GSLC_LOCAL_STR_LEN bytes in every element
+#define GSLC_STR_ARENA      0     // 1=Allocate local strings from arena, 0=Fixed buffer
+#define GSLC_STR_ARENA_SIZE 2048  // Total size of the string arena (bytes)
+
+// With the floating point library (GSLC_USE_FLOAT=1), the sin/cos functions
+// can use a full-resolution quarter-wave lookup table generated on first use
+#define GSLC_TRIG_LUT_FULL  1     // 1=Full-resolution lookup table (11.5KB RAM), 0=Math library
+
 
 // Debug modes
 // - Uncomment the following to enable specific debug modes
 //#define DBG_LOG           // Enable debugging log output
 //#define DBG_TOUCH         // Enable debugging of touch-presses
 //#define DBG_FRAME_RATE    // Enable diagnostic frame rate reporting
+//#define DBG_REDRAW        // Enable diagnostic redraw (drawn / culled) reporting
 //#define DBG_DRAW_IMM      // Enable immediate rendering of drawing primitives
 //#define DBG_DRIVER        // Enable graphics driver debug reporting
 
@@ -97,6 +97,10 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FRAME      1 ///< Support gslc_DrvDrawFrameTriangle()
 #define DRV_HAS_DRAW_TRI_FILL       1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_RECT_COPY      0 ///< Support gslc_DrvDrawCopyRect()
+#define DRV_HAS_DRAW_RECT_SAVE      0 ///< Support gslc_DrvSaveRect() / gslc_DrvRestoreRect()
+#define DRV_HAS_DRAW_LAYER          0 ///< Support gslc_DrvLayerSave() / gslc_DrvLayerRestore()
+#define DRV_HAS_DRAW_SPANS          0 ///< Support gslc_DrvDrawFillSpans()
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
 
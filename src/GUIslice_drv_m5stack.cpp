@@ -181,7 +181,7 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  GSLC_ELEM_IMG_NORM_W(pElem) = sImgRef;
   return true; // TODO
 }
 
@@ -190,7 +190,7 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  GSLC_ELEM_IMG_GLOW_W(pElem) = sImgRef;
   return true; // TODO
 }
 
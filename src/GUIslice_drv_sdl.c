@@ -93,7 +93,12 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
 
     #if defined(DRV_DISP_SDL1)
+    uint8_t nInd;
     pDriver->pSurfScreen = NULL;
+    pDriver->pSurfSave   = NULL;
+    for (nInd=0;nInd<DRV_COL_CACHE_SIZE;nInd++) {
+      pDriver->anColCacheKey[nInd] = DRV_COL_CACHE_NONE;
+    }
     pGui->bRedrawPartialEn = true;
     #endif
 
@@ -242,6 +247,8 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
 
 void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
+  gslc_DrvDiscardRect(pGui);
+
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   if (pDriver->pRender) {
@@ -450,14 +457,14 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
 bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
   // Dispose of previous image
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  if (GSLC_ELEM_IMG_NORM(pElem).eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(GSLC_ELEM_IMG_NORM(pElem).pvImgRaw);
+    GSLC_ELEM_IMG_NORM_W(pElem) = gslc_ResetImage();
   }
 
-  pElem->sImgRefNorm = sImgRef;
-  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefNorm.pvImgRaw == NULL) {
+  GSLC_ELEM_IMG_NORM_W(pElem) = sImgRef;
+  GSLC_ELEM_IMG_NORM_W(pElem).pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (GSLC_ELEM_IMG_NORM(pElem).pvImgRaw == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
     return false;
   }
@@ -468,14 +475,14 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
   // Dispose of previous image
-  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if (GSLC_ELEM_IMG_GLOW(pElem).eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(GSLC_ELEM_IMG_GLOW(pElem).pvImgRaw);
+    GSLC_ELEM_IMG_GLOW_W(pElem) = gslc_ResetImage();
   }
 
-  pElem->sImgRefGlow = sImgRef;
-  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefGlow.pvImgRaw == NULL) {
+  GSLC_ELEM_IMG_GLOW_W(pElem) = sImgRef;
+  GSLC_ELEM_IMG_GLOW_W(pElem).pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (GSLC_ELEM_IMG_GLOW(pElem).pvImgRaw == NULL) {
     GSLC_DEBUG_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
     return false;
   }
@@ -726,8 +733,7 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
 
   // Call SDL optimized routine
-  SDL_FillRect(pScreen,&rSRect,
-    SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b));
+  SDL_FillRect(pScreen,&rSRect,gslc_DrvAdaptColorRaw(pGui,nCol));
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
@@ -741,6 +747,48 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
   return true;
 }
 
+bool gslc_DrvDrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t nInd;
+#if defined(DRV_DISP_SDL1)
+  SDL_Surface*  pScreen = pDriver->pSurfScreen;
+  SDL_Rect      rSRect;
+
+  // Convert the color once for the whole batch
+  uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  rSRect.h = 1;
+  for (nInd=0;nInd<nSpanCnt;nInd++) {
+    rSRect.x = asSpan[nInd].nX;
+    rSRect.y = asSpan[nInd].nY;
+    rSRect.w = asSpan[nInd].nW;
+    // Call SDL optimized routine
+    SDL_FillRect(pScreen,&rSRect,nColRaw);
+  }
+#endif
+#if defined(DRV_DISP_SDL2)
+  SDL_Renderer* pRender = pDriver->pRender;
+  SDL_Rect      arRectSdl[DRV_SPAN_RECT_MAX];
+  uint16_t      nRectCnt = 0;
+  SDL_SetRenderDrawColor(pRender,nCol.r,nCol.g,nCol.b,255);
+
+  // Pass the spans to the renderer in chunks
+  for (nInd=0;nInd<nSpanCnt;nInd++) {
+    arRectSdl[nRectCnt].x = asSpan[nInd].nX;
+    arRectSdl[nRectCnt].y = asSpan[nInd].nY;
+    arRectSdl[nRectCnt].w = asSpan[nInd].nW;
+    arRectSdl[nRectCnt].h = 1;
+    nRectCnt++;
+    if ((nRectCnt == DRV_SPAN_RECT_MAX) || (nInd == nSpanCnt-1)) {
+      // Call SDL optimized routine
+      SDL_RenderFillRects(pRender,arRectSdl,nRectCnt);
+      nRectCnt = 0;
+    }
+  }
+#endif
+  return true;
+}
+
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
@@ -777,6 +825,191 @@ bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16
 #endif
 }
 
+bool gslc_DrvDrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+
+  // Clip the source and destination regions to the active clipping
+  // region (see gslc_DrvSetClipRect), which SDL keeps within the
+  // screen extents
+  int32_t nCX0  = pScreen->clip_rect.x;
+  int32_t nCY0  = pScreen->clip_rect.y;
+  int32_t nCX1  = nCX0 + pScreen->clip_rect.w;
+  int32_t nCY1  = nCY0 + pScreen->clip_rect.h;
+  int32_t nSrcX = rSrc.x;
+  int32_t nSrcY = rSrc.y;
+  int32_t nDX   = nDstX;
+  int32_t nDY   = nDstY;
+  int32_t nW    = rSrc.w;
+  int32_t nH    = rSrc.h;
+  int32_t nAdj;
+  nAdj = ((nSrcX < nDX)? nSrcX : nDX) - nCX0;
+  if (nAdj < 0) { nSrcX -= nAdj; nDX -= nAdj; nW += nAdj; }
+  nAdj = ((nSrcY < nDY)? nSrcY : nDY) - nCY0;
+  if (nAdj < 0) { nSrcY -= nAdj; nDY -= nAdj; nH += nAdj; }
+  nAdj = ((nSrcX > nDX)? nSrcX : nDX) + nW - nCX1;
+  if (nAdj > 0) { nW -= nAdj; }
+  nAdj = ((nSrcY > nDY)? nSrcY : nDY) + nH - nCY1;
+  if (nAdj > 0) { nH -= nAdj; }
+  if ((nW <= 0) || (nH <= 0)) {
+    return true;
+  }
+
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  int32_t   nBpp      = pScreen->format->BytesPerPixel;
+  int32_t   nPitch    = pScreen->pitch;
+  uint8_t*  pPixels   = (uint8_t*)pScreen->pixels;
+  int32_t   nRowBytes = nW * nBpp;
+  int32_t   nRow;
+  // Copy the rows in an order that is safe for overlapping regions.
+  // Within a row, memmove() handles any horizontal overlap.
+  if (nDY <= nSrcY) {
+    for (nRow=0;nRow<nH;nRow++) {
+      memmove(pPixels + (nDY+nRow)*nPitch + nDX*nBpp,
+              pPixels + (nSrcY+nRow)*nPitch + nSrcX*nBpp,nRowBytes);
+    }
+  } else {
+    for (nRow=nH-1;nRow>=0;nRow--) {
+      memmove(pPixels + (nDY+nRow)*nPitch + nDX*nBpp,
+              pPixels + (nSrcY+nRow)*nPitch + nSrcX*nBpp,nRowBytes);
+    }
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The SDL2 renderer does not retain the previous frame
+  // (see gslc_DrvPageFlipNow) so there is nothing to copy from
+  return false;
+#endif
+}
+
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+
+  // Discard any previously saved region
+  gslc_DrvDiscardRect(pGui);
+
+  // Create an offscreen surface that matches the screen format
+  SDL_PixelFormat* pFmt = pScreen->format;
+  SDL_Surface* pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,rRect.w,rRect.h,pFmt->BitsPerPixel,
+    pFmt->Rmask,pFmt->Gmask,pFmt->Bmask,pFmt->Amask);
+  if (pSurf == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: DrvSaveRect() error in SDL_CreateRGBSurface(): %s\n",SDL_GetError());
+    return false;
+  }
+
+  // Copy the screen region into the offscreen surface
+  SDL_Rect rSrc = gslc_DrvAdaptRect(rRect);
+  if (SDL_BlitSurface(pScreen,&rSrc,pSurf,NULL) != 0) {
+    SDL_FreeSurface(pSurf);
+    return false;
+  }
+  pDriver->pSurfSave  = pSurf;
+  pDriver->rSave      = rRect;
+  return true;
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The SDL2 renderer does not retain the previous frame
+  // (see gslc_DrvPageFlipNow) so there is nothing to save
+  return false;
+#endif
+}
+
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSurfSave == NULL) {
+    return false;
+  }
+  SDL_Rect rDst = gslc_DrvAdaptRect(pDriver->rSave);
+  bool bOk = (SDL_BlitSurface(pDriver->pSurfSave,NULL,pDriver->pSurfScreen,&rDst) == 0);
+  gslc_DrvDiscardRect(pGui);
+  return bOk;
+#endif
+#if defined(DRV_DISP_SDL2)
+  return false;
+#endif
+}
+
+void gslc_DrvDiscardRect(gslc_tsGui* pGui)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pSurfSave != NULL) {
+    SDL_FreeSurface(pDriver->pSurfSave);
+    pDriver->pSurfSave = NULL;
+  }
+#endif
+}
+
+bool gslc_DrvLayerSave(gslc_tsGui* pGui,void** ppvLayer)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Surface*   pSurf = (SDL_Surface*)(*ppvLayer);
+
+  // Create an offscreen surface that matches the screen
+  if (pSurf == NULL) {
+    SDL_PixelFormat* pFmt = pScreen->format;
+    pSurf = SDL_CreateRGBSurface(SDL_SWSURFACE,pScreen->w,pScreen->h,pFmt->BitsPerPixel,
+      pFmt->Rmask,pFmt->Gmask,pFmt->Bmask,pFmt->Amask);
+    if (pSurf == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvLayerSave() error in SDL_CreateRGBSurface(): %s\n",SDL_GetError());
+      return false;
+    }
+    *ppvLayer = (void*)pSurf;
+  }
+
+  // Copy the screen into the offscreen surface
+  return (SDL_BlitSurface(pScreen,NULL,pSurf,NULL) == 0);
+#endif
+#if defined(DRV_DISP_SDL2)
+  // The SDL2 renderer does not retain the previous frame
+  // (see gslc_DrvPageFlipNow) so there is nothing to save
+  (void)ppvLayer; // Unused
+  return false;
+#endif
+}
+
+bool gslc_DrvLayerRestore(gslc_tsGui* pGui,void* pvLayer,gslc_tsRect rRect)
+{
+#if defined(DRV_DISP_SDL1)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pvLayer == NULL) {
+    return false;
+  }
+  SDL_Rect rSrc = gslc_DrvAdaptRect(rRect);
+  SDL_Rect rDst = rSrc;
+  return (SDL_BlitSurface((SDL_Surface*)pvLayer,&rSrc,pDriver->pSurfScreen,&rDst) == 0);
+#endif
+#if defined(DRV_DISP_SDL2)
+  (void)pvLayer; // Unused
+  (void)rRect; // Unused
+  return false;
+#endif
+}
+
+void gslc_DrvLayerDestroy(gslc_tsGui* pGui,void** ppvLayer)
+{
+  (void)pGui; // Unused
+#if defined(DRV_DISP_SDL1)
+  if (*ppvLayer != NULL) {
+    SDL_FreeSurface((SDL_Surface*)(*ppvLayer));
+  }
+#endif
+  *ppvLayer = NULL;
+}
+
 bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
 {
   if (pGui == NULL) {
@@ -1208,7 +1441,16 @@ uint32_t gslc_DrvAdaptColorRaw(gslc_tsGui* pGui,gslc_tsColor nCol)
   }
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
   SDL_Surface*   pScreen = pDriver->pSurfScreen;
-  return SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b);
+
+  // Look up the color in the cache of recently converted colors
+  // - The cache is direct-mapped with a multiplicative hash of the RGB value
+  uint32_t nKey = ((uint32_t)nCol.r << 16) | ((uint32_t)nCol.g << 8) | nCol.b;
+  uint8_t  nInd = (uint8_t)((nKey * 0x9E3779B1u) >> (32 - DRV_COL_CACHE_BITS));
+  if (pDriver->anColCacheKey[nInd] != nKey) {
+    pDriver->anColCacheKey[nInd] = nKey;
+    pDriver->anColCacheRaw[nInd] = SDL_MapRGB(pScreen->format,nCol.r,nCol.g,nCol.b);
+  }
+  return pDriver->anColCacheRaw[nInd];
 }
 
 
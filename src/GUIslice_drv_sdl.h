@@ -83,6 +83,10 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FRAME      0 ///< Support gslc_DrvDrawFrameTriangle()
   #define DRV_HAS_DRAW_TRI_FILL       0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+  #define DRV_HAS_DRAW_RECT_COPY      1 ///< Support gslc_DrvDrawCopyRect()
+  #define DRV_HAS_DRAW_RECT_SAVE      1 ///< Support gslc_DrvSaveRect() / gslc_DrvRestoreRect()
+  #define DRV_HAS_DRAW_LAYER          1 ///< Support gslc_DrvLayerSave() / gslc_DrvLayerRestore()
+  #define DRV_HAS_DRAW_SPANS          1 ///< Support gslc_DrvDrawFillSpans()
 #endif
 
 #if defined(DRV_DISP_SDL2)
@@ -95,10 +99,27 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FRAME      0 ///< Support gslc_DrvDrawFrameTriangle()
   #define DRV_HAS_DRAW_TRI_FILL       0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT           1 ///< Support gslc_DrvDrawTxt()
+  #define DRV_HAS_DRAW_RECT_COPY      0 ///< Support gslc_DrvDrawCopyRect()
+  #define DRV_HAS_DRAW_RECT_SAVE      0 ///< Support gslc_DrvSaveRect() / gslc_DrvRestoreRect()
+  #define DRV_HAS_DRAW_LAYER          0 ///< Support gslc_DrvLayerSave() / gslc_DrvLayerRestore()
+  #define DRV_HAS_DRAW_SPANS          1 ///< Support gslc_DrvDrawFillSpans()
+
+  /// Maximum number of spans passed to the renderer in each call
+  #define DRV_SPAN_RECT_MAX         32
 #endif
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
 
+#if defined(DRV_DISP_SDL1)
+  /// Size of the native color cache (log2 of the number of entries)
+  /// - Recently used colors are cached with their screen pixel values
+  ///   to avoid a format conversion for every primitive drawn
+  #define DRV_COL_CACHE_BITS        3
+  #define DRV_COL_CACHE_SIZE        (1<<DRV_COL_CACHE_BITS)
+  /// Key of an empty color cache entry
+  #define DRV_COL_CACHE_NONE        0xFFFFFFFF
+#endif
+
 // =======================================================================
 // Driver-specific members
 // =======================================================================
@@ -106,6 +127,10 @@ typedef struct {
 
   #if defined(DRV_DISP_SDL1)
   SDL_Surface*        pSurfScreen;      ///< Surface ptr for screen
+  SDL_Surface*        pSurfSave;        ///< Surface ptr for saved screen region (or NULL)
+  gslc_tsRect         rSave;            ///< Location of saved screen region
+  uint32_t            anColCacheKey[DRV_COL_CACHE_SIZE]; ///< Color cache: RGB of each entry (DRV_COL_CACHE_NONE if empty)
+  uint32_t            anColCacheRaw[DRV_COL_CACHE_SIZE]; ///< Color cache: screen pixel value of each entry
   #endif
 
   #if defined(DRV_DISP_SDL2)
@@ -393,6 +418,19 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 
 
+///
+/// Draw a batch of filled horizontal spans
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asSpan:      Array of spans
+/// \param[in]  nSpanCnt:    Number of spans in array
+/// \param[in]  nCol:        Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillSpans(gslc_tsGui* pGui,const gslc_tsSpan* asSpan,uint16_t nSpanCnt,gslc_tsColor nCol);
+
+
 ///
 /// Draw a line
 ///
@@ -408,6 +446,97 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
 
 
+///
+/// Copy a rectangular region of the screen to another location
+/// - The source and destination regions may overlap
+/// - Regions are clipped to the screen extents
+/// - Only supported in SDL1 mode, where the screen surface is
+///   retained between frames
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Source region to copy
+/// \param[in]  nDstX:       Destination X coord (top-left)
+/// \param[in]  nDstY:       Destination Y coord (top-left)
+///
+/// \return true if success, false if not supported or error
+///
+bool gslc_DrvDrawCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
+
+///
+/// Save a region of the display so that it can be restored later
+/// - Any previously saved region is discarded
+/// - Only supported in SDL1 mode, where the screen surface is
+///   retained between frames
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Region of the display to save
+///
+/// \return true if success, false if not supported or error
+///
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect);
+
+
+///
+/// Restore the region of the display saved by gslc_DrvSaveRect()
+/// - The saved region is released afterwards
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return true if success, false if no region was saved or error
+///
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui);
+
+
+///
+/// Release the region of the display saved by gslc_DrvSaveRect()
+/// without restoring it
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDiscardRect(gslc_tsGui* pGui);
+
+
+///
+/// Capture the entire display into an offscreen layer
+/// - If the layer already exists then it is reused, otherwise
+///   a new layer is allocated and returned in ppvLayer
+/// - Only supported in SDL1 mode, where the screen surface is
+///   retained between frames
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[inout] ppvLayer:  Pointer to the layer handle (NULL handle to allocate)
+///
+/// \return true if success, false if not supported or error
+///
+bool gslc_DrvLayerSave(gslc_tsGui* pGui,void** ppvLayer);
+
+
+///
+/// Copy a region of an offscreen layer to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvLayer:     Layer handle from gslc_DrvLayerSave()
+/// \param[in]  rRect:       Region of the layer to copy
+///
+/// \return true if success, false if not supported or error
+///
+bool gslc_DrvLayerRestore(gslc_tsGui* pGui,void* pvLayer,gslc_tsRect rRect);
+
+
+///
+/// Release an offscreen layer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[inout] ppvLayer:  Pointer to the layer handle (reset to NULL)
+///
+/// \return none
+///
+void gslc_DrvLayerDestroy(gslc_tsGui* pGui,void** ppvLayer);
+
+
 // TODO: Add DrvDrawFrameCircle()
 // TODO: Add DrvDrawFillCircle()
 // TODO: Add DrvDrawFrameTriangle()
@@ -574,6 +703,7 @@ void gslc_DrvScreenUnlock(gslc_tsGui* pGui);
 /// Convert an RGB color triplet into the surface pixel value.
 /// This is called to produce the native pixel value required by
 /// the raw pixel manipulation routines.
+/// Recently converted colors are looked up in the driver's color cache.
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nCol:        RGB value for conversion
@@ -78,6 +78,14 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 //   the element.
 // ============================================================================
 
+// Element type dispatch table
+// - NOTE: The touch callback is optional (and can be set to NULL).
+//   See the discussion under gslc_ElemXCheckboxTouch()
+static const gslc_tsElemType GSLC_PMEM XCHECKBOX_TYPE = {
+  GSLC_TYPEX_CHECKBOX,&gslc_ElemXCheckboxDraw,&gslc_ElemXCheckboxTouch,NULL,
+  &gslc_ElemXCheckboxLink
+};
+
 // Create a checkbox element and add it to the GUI element list
 // - Defines default styling for the element
 // - Defines callback for redraw but does not track touch/click
@@ -85,16 +93,27 @@ gslc_tsElemRef* gslc_ElemXCheckboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_
   gslc_tsXCheckbox* pXData,gslc_tsRect rElem,bool bRadio,gslc_teXCheckboxStyle nStyle,
   gslc_tsColor colCheck,bool bChecked)
 {
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXCheckbox*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXCheckbox));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
   gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_CHECKBOX,rElem,NULL,0,GSLC_FONT_NONE);
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
+  sElem.nFeatures        |= GSLC_ELEM_FEA_OPAQUE;     // Background fills the full bounds
   sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures        |= GSLC_ELEM_FEA_GLOW_EN;
 
@@ -107,18 +126,20 @@ gslc_tsElemRef* gslc_ElemXCheckboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_
   pXData->colCheck        = colCheck;
   pXData->nStyle          = nStyle;
   pXData->pfuncXToggle    = NULL;
+  pXData->pRadioNext      = NULL;
   sElem.pXData            = (void*)(pXData);
-  // Specify the custom drawing callback
-  sElem.pfuncXDraw        = &gslc_ElemXCheckboxDraw;
-  // Specify the custom touch tracking callback
-  // - NOTE: This is optional (and can be set to NULL).
-  //   See the discussion under gslc_ElemXCheckboxTouch()
-  sElem.pfuncXTouch       = &gslc_ElemXCheckboxTouch;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XCHECKBOX_TYPE)) {
+    return NULL;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   if (nPage != GSLC_PAGE_NONE) {
+    // Any radio button is linked with its group when added
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
 #if (GSLC_FEATURE_COMPOUND)
@@ -142,56 +163,107 @@ bool gslc_ElemXCheckboxGetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
 }
 
 
-// Determine which checkbox in the group has been "checked"
-gslc_tsElemRef* gslc_ElemXCheckboxFindChecked(gslc_tsGui* pGui,int16_t nGroupId)
+// Find the checked radio button in the ring of a radio button's group
+// - The search starts with the radio button itself
+static gslc_tsElemRef* gslc_ElemXCheckboxRingChecked(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
 {
-  int16_t             nCurInd;
-  gslc_tsElemRef*     pCurElemRef = NULL;
-  gslc_tsElem*        pCurElem = NULL;
-  int16_t             nCurType;
-  int16_t             nCurGroup;
-  bool                bCurChecked;
-  gslc_tsElemRef*     pFoundElemRef = NULL;
-
-  // Operate on current page
-  // TODO: Support other page layers
-  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_CUR];
-  if (pPage == NULL) {
-    return NULL; // No page added yet
-  }
+  gslc_tsElemRef*     pCurElemRef = pElemRef;
+  gslc_tsXCheckbox*   pCurCheckbox = NULL;
 
-  if (pGui == NULL) {
-    static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxFindChecked";
+  do {
+    pCurCheckbox = (gslc_tsXCheckbox*)(gslc_GetElemFromRef(pGui,pCurElemRef)->pXData);
+    if (pCurCheckbox->bChecked) {
+      return pCurElemRef;
+    }
+    pCurElemRef = pCurCheckbox->pRadioNext;
+  } while ((pCurElemRef != NULL) && (pCurElemRef != pElemRef));
+  return NULL;
+}
+
+// Link or unlink a radio button with the ring of its group
+// - Each group maintains its own ring through the extended data
+//   of its radio buttons, so group operations only visit the
+//   members of the group
+// - The ring of each group is located through the GUI's group
+//   ring table (see gslc_GroupRingGet), so no pages are searched
+bool gslc_ElemXCheckboxLink(void* pvGui,void* pvCollect,void* pvElemRef,bool bLink)
+{
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxLink";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
-    return NULL;
+    return false;
   }
+  (void)pvCollect; // Unused
+  gslc_tsGui*         pGui      = (gslc_tsGui*)(pvGui);
+  gslc_tsElemRef*     pElemRef  = (gslc_tsElemRef*)(pvElemRef);
+  gslc_tsElem*        pElem     = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXCheckbox*   pCheckbox = (gslc_tsXCheckbox*)(pElem->pXData);
+  int16_t             nGroup    = pElem->nGroup;
 
-  gslc_tsCollect* pCollect = &pPage->sCollect;
-  for (nCurInd=0;nCurInd<pCollect->nElemCnt;nCurInd++) {
-    // Fetch extended data
-    pCurElemRef   = &(pCollect->asElemRef[nCurInd]);
-    pCurElem      = gslc_GetElemFromRef(pGui,pCurElemRef);
-    nCurType      = pCurElem->nType;
-    // Only want to proceed if it is a checkbox
-    if (nCurType != GSLC_TYPEX_CHECKBOX) {
-      continue;
+  if ((pCheckbox == NULL) || (!pCheckbox->bRadio)) {
+    // Not a radio button
+    return false;
+  }
+  bool                bLinked   = (pCheckbox->pRadioNext != NULL);
+  gslc_tsElemRef*     pRingRef  = NULL;
+  gslc_tsXCheckbox*   pRing     = NULL;
+
+  if (bLink && !bLinked) {
+    pRingRef = gslc_GroupRingGet(pGui,nGroup);
+    if (pRingRef == NULL) {
+      // First radio button in the group forms a ring of one
+      if (gslc_GroupRingSet(pGui,nGroup,pElemRef)) {
+        pCheckbox->pRadioNext = pElemRef;
+      }
+    } else {
+      // Insert into the group's ring
+      pRing = (gslc_tsXCheckbox*)(gslc_GetElemFromRef(pGui,pRingRef)->pXData);
+      pCheckbox->pRadioNext = pRing->pRadioNext;
+      pRing->pRadioNext = pElemRef;
+    }
+  } else if (!bLink && bLinked) {
+    // Locate the preceding radio button in the ring and bypass
+    // this one (a ring of one is its own predecessor)
+    pRing = pCheckbox;
+    while (pRing->pRadioNext != pElemRef) {
+      pRing = (gslc_tsXCheckbox*)(gslc_GetElemFromRef(pGui,pRing->pRadioNext)->pXData);
     }
+    pRing->pRadioNext = pCheckbox->pRadioNext;
+    // Locate the group's ring through a remaining member
+    if (gslc_GroupRingGet(pGui,nGroup) == pElemRef) {
+      gslc_GroupRingSet(pGui,nGroup,(pRing == pCheckbox)? NULL : pCheckbox->pRadioNext);
+    }
+    pCheckbox->pRadioNext = NULL;
+  }
+  return bLinked;
+}
 
-    nCurGroup     = pCurElem->nGroup;
-    bCurChecked   = gslc_ElemXCheckboxGetState(pGui,pCurElemRef);
+// Link a radio button into the ring of radio buttons in its group
+void gslc_ElemXCheckboxRadioLink(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxRadioLink";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_ElemXCheckboxLink((void*)(pGui),NULL,(void*)(pElemRef),true);
+}
 
-    // If this is in a different group, ignore it
-    if (nCurGroup != nGroupId) {
-      continue;
-    }
+// Determine which radio button in the group has been "checked"
+gslc_tsElemRef* gslc_ElemXCheckboxFindChecked(gslc_tsGui* pGui,int16_t nGroupId)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxFindChecked";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
 
-    // Did we find an element in the group that was checked?
-    if (bCurChecked) {
-      pFoundElemRef = pCurElemRef;
-      break;
-    }
-  } // nCurInd
-  return pFoundElemRef;
+  // Locate any member of the group and then traverse its ring
+  gslc_tsElemRef*     pRingRef = gslc_GroupRingGet(pGui,nGroupId);
+  if (pRingRef == NULL) {
+    return NULL;
+  }
+  return gslc_ElemXCheckboxRingChecked(pGui,pRingRef);
 }
 
 // Assign the callback function for checkbox/radio state change events
@@ -242,7 +314,6 @@ void gslc_ElemXCheckboxSetStateHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bo
   // - If one  selected: return selected ID and state=true
   if (pCheckbox->pfuncXToggle != NULL) {
     gslc_tsElemRef* pRetRef = NULL;
-    int16_t nGroup = GSLC_GROUP_ID_NONE;
     int16_t nSelId = GSLC_ID_NONE;
     if (!pCheckbox->bRadio) {
       // Checkbox
@@ -253,10 +324,8 @@ void gslc_ElemXCheckboxSetStateHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bo
       }
     } else {
       // Radio button
-      // - Determine the group that the radio button belongs to
-      nGroup = pElem->nGroup;
-      // Determine if any radio button in the group has been selected
-      pRetRef = gslc_ElemXCheckboxFindChecked(pGui, nGroup);
+      // - Determine if any radio button in the group has been selected
+      pRetRef = gslc_ElemXCheckboxRingChecked(pGui,pElemRef);
       if (pRetRef != NULL) {
         // One has been selected, return its ID
         bChecked = true;
@@ -277,14 +346,7 @@ void gslc_ElemXCheckboxSetStateHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bo
 // then also update the state of all other buttons in the group.
 void gslc_ElemXCheckboxSetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bChecked)
 {
-  // Operate on current page
-  // TODO: Support other page layers
-  gslc_tsPage* pPage = pGui->apPageStack[GSLC_STACK_CUR];
-  if (pPage == NULL) {
-    return; // No page added yet
-  }
-
-  if (pElemRef == NULL) {
+  if ((pGui == NULL) || (pElemRef == NULL)) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXCheckboxSetState";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
@@ -293,67 +355,37 @@ void gslc_ElemXCheckboxSetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool b
   gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
   gslc_tsXCheckbox*   pCheckbox = (gslc_tsXCheckbox*)(pElem->pXData);
   bool                bRadio    = pCheckbox->bRadio;
-  int16_t             nGroup    = pElem->nGroup;
-  int16_t             nElemId   = pElem->nId;
 
   // Special handling when we select a radio button
   if (bRadio && bChecked) {
 
     // If we are selecting a radio button that is already
     // selected, then skip further update events.
-    // NOTE: This check is not very efficient, but it avoids
-    // the creation of extra events.
-    gslc_tsElemRef* pTmpRef = gslc_ElemXCheckboxFindChecked(pGui, nGroup);
-    if (pTmpRef == pElemRef) {
+    if (pCheckbox->bChecked) {
       // Same element, so skip
       return;
     }
 
     // Proceed to deselect any other selected items in the group.
-    // Note that SetState calls itself to deselect other items so it
-    // is important to qualify this logic with bChecked=true
-    int16_t           nCurInd;
-    int16_t           nCurId;
+    // - Only the ring of the group's radio buttons needs to be
+    //   traversed rather than all of the elements on the page
+    // - Note that SetState calls itself to deselect other items so it
+    //   is important to qualify this logic with bChecked=true
+    gslc_tsElemRef*   pCurElemRef = pCheckbox->pRadioNext;
+    gslc_tsElemRef*   pNextElemRef = NULL;
     gslc_tsElem*      pCurElem = NULL;
-    gslc_tsElemRef*   pCurElemRef = NULL;
-    int16_t           nCurType;
-    int16_t           nCurGroup;
-
-    // We use the GUI pointer for access to other elements
-    // NOTE: There is an assumption that we are calling ElemXCheckboxSetState
-    //       on a checkbox on the current page.
-
-    gslc_tsCollect* pCollect = &pPage->sCollect;
-    for (nCurInd=0;nCurInd<pCollect->nElemRefCnt;nCurInd++) {
-      // Fetch extended data
-      pCurElemRef   = &pCollect->asElemRef[nCurInd];
-      pCurElem      = gslc_GetElemFromRef(pGui,pCurElemRef);
-
-      // FIXME: Handle pCurElemRef->eElemFlags
-      nCurId        = pCurElem->nId;
-      nCurType      = pCurElem->nType;
+    gslc_tsXCheckbox* pCurCheckbox = NULL;
 
-      // Only want to proceed if it is a checkbox
-      if (nCurType != GSLC_TYPEX_CHECKBOX) {
-        continue;
-      }
-
-      nCurGroup     = pCurElem->nGroup;
-
-      // If this is in a different group, ignore it
-      if (nCurGroup != nGroup) {
-        continue;
-      }
-
-      // Is this our element? If so, ignore the deselect operation
-      if (nCurId == nElemId) {
-        continue;
-      }
+    while ((pCurElemRef != NULL) && (pCurElemRef != pElemRef)) {
+      pCurElem      = gslc_GetElemFromRef(pGui,pCurElemRef);
+      pCurCheckbox  = (gslc_tsXCheckbox*)(pCurElem->pXData);
+      pNextElemRef  = pCurCheckbox->pRadioNext;
 
-      // Deselect all other elements
+      // Deselect all other elements in the group
       gslc_ElemXCheckboxSetStateHelp(pGui,pCurElemRef,false);
 
-    } // nInd
+      pCurElemRef = pNextElemRef;
+    } // pCurElemRef
 
   } // bRadio
 
@@ -409,7 +441,7 @@ bool gslc_ElemXCheckboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   bool bGlow     = (pElem->nFeatures & GSLC_ELEM_FEA_GLOW_EN) && gslc_ElemGetGlow(pGui,pElemRef);
 
   // Draw the background
-  gslc_DrawFillRect(pGui,pElem->rElem,pElem->colElemFill);
+  gslc_DrawFillRect(pGui,pElem->rElem,GSLC_ELEM_COL_FILL(pGui,pElem));
 
   // Generic coordinate calcs
   int16_t nX0,nY0,nX1,nY1,nMidX,nMidY;
@@ -430,7 +462,7 @@ bool gslc_ElemXCheckboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
       // we don't need to do anything more in the unchecked case
     }
     // Draw a frame around the checkbox
-    gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFrameGlow:pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem):GSLC_ELEM_COL_FRAME(pGui,pElem));
 
   } else if (nStyle == GSLCX_CHECKBOX_STYLE_X) {
     // Draw an X through center if checked
@@ -439,7 +471,7 @@ bool gslc_ElemXCheckboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
       gslc_DrawLine(pGui,nX0,nY1,nX1,nY0,pCheckbox->colCheck);
     }
     // Draw a frame around the checkbox
-    gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFrameGlow:pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem):GSLC_ELEM_COL_FRAME(pGui,pElem));
 
   } else if (nStyle == GSLCX_CHECKBOX_STYLE_ROUND) {
     // Draw inner circle if checked
@@ -447,7 +479,7 @@ bool gslc_ElemXCheckboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
       gslc_DrawFillCircle(pGui,nMidX,nMidY,5,pCheckbox->colCheck);
     }
     // Draw a frame around the checkbox
-    gslc_DrawFrameCircle(pGui,nMidX,nMidY,(pElem->rElem.w/2),(bGlow)?pElem->colElemFrameGlow:pElem->colElemFrame);
+    gslc_DrawFrameCircle(pGui,nMidX,nMidY,(pElem->rElem.w/2),(bGlow)?GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem):GSLC_ELEM_COL_FRAME(pGui,pElem));
 
   }
 
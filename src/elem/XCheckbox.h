@@ -71,6 +71,7 @@ typedef struct {
   bool                        bChecked;     ///< Indicates if it is selected (checked)
   gslc_tsColor                colCheck;     ///< Color of checked inner fill
   GSLC_CB_XCHECKBOX           pfuncXToggle; ///< Callback event to say element has changed
+  gslc_tsElemRef*             pRadioNext;   ///< Next radio button in the group's ring (or NULL if not linked)
 } gslc_tsXCheckbox;
 
 
@@ -81,6 +82,7 @@ typedef struct {
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining checkbox size
 /// \param[in]  bRadio:      Radio-button functionality if true
 /// \param[in]  nStyle:      Drawing style for checkbox / radio button
@@ -116,7 +118,9 @@ bool gslc_ElemXCheckboxGetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
 void gslc_ElemXCheckboxSetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bChecked);
 
 ///
-/// Find the checkbox within a group that has been checked
+/// Find the radio button within a group that has been checked
+/// - The search covers radio buttons on all pages
+/// - Only the members of the group's ring are visited
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nGroupId:    Group ID to search
@@ -125,6 +129,22 @@ void gslc_ElemXCheckboxSetState(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool b
 ///
 gslc_tsElemRef* gslc_ElemXCheckboxFindChecked(gslc_tsGui* pGui,int16_t nGroupId);
 
+///
+/// Link a radio button into the ring of radio buttons in its group
+/// - The ring enables group selection and lookup without
+///   scanning the elements on each page
+/// - Called automatically when the element is added to a collection
+///   and by the read-only element macros
+/// - Has no effect on checkboxes or radio buttons that
+///   are already linked
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return none
+///
+void gslc_ElemXCheckboxRadioLink(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
 ///
 /// Toggle a Checkbox element's current state
 ///
@@ -171,6 +191,21 @@ bool gslc_ElemXCheckboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
 /// \return true if success, false otherwise
 ///
 bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16_t nRelX,int16_t nRelY);
+
+///
+/// Link or unlink a radio button with the ring of its group
+/// - Called when the element is added to or removed from a collection
+/// - The ring of the group is located through gslc_GroupRingGet()
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvCollect:   Void ptr to collection holding the element
+///                          (typecast to gslc_tsCollect*) or NULL
+/// \param[in]  pvElemRef:   Void ptr to Element reference (typecast to gslc_tsElemRef*)
+/// \param[in]  bLink:       Link into the ring if true, unlink otherwise
+///
+/// \return true if the element was linked before the call
+///
+bool gslc_ElemXCheckboxLink(void* pvGui,void* pvCollect,void* pvElemRef,bool bLink);
 // ============================================================================
 
 // ------------------------------------------------------------------------
@@ -203,16 +238,19 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
 /// \return none
 ///
 
+// - Not available in the compact element layout (GSLC_FEATURE_COMPACT_ELEM)
+#if !(GSLC_FEATURE_COMPACT_ELEM)
 #if (GSLC_USE_PROGMEM)
 
 #define gslc_ElemXCheckboxCreate_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFill,bFillEn,nGroup,bRadio_,nStyle_,colCheck_,bChecked_) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     GSLC_ELEM_FEA_GLOW_EN | GSLC_ELEM_FEA_CLICK_EN | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static gslc_tsXCheckbox sCheckbox##nElemId;                     \
   sCheckbox##nElemId.bRadio = bRadio_;                            \
   sCheckbox##nElemId.bChecked = bChecked_;                        \
   sCheckbox##nElemId.colCheck = colCheck_;                        \
   sCheckbox##nElemId.nStyle = nStyle_;                            \
+  sCheckbox##nElemId.pRadioNext = NULL;                           \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -232,25 +270,26 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
       0,                                                          \
       NULL,                                                       \
       (void*)(&sCheckbox##nElemId),                               \
-      NULL,                                                       \
       &gslc_ElemXCheckboxDraw,                                    \
       &gslc_ElemXCheckboxTouch,                                   \
       NULL,                                                       \
   };                                                              \
-  gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
-    (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
+  gslc_ElemXCheckboxRadioLink(pGui,                               \
+    gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,        \
+    (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL)));
 
 
 #else
 
 #define gslc_ElemXCheckboxCreate_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFill,bFillEn,nGroup,bRadio_,nStyle_,colCheck_,bChecked_) \
-  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
+  static const uint8_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_OPAQUE | \
     GSLC_ELEM_FEA_GLOW_EN | GSLC_ELEM_FEA_CLICK_EN | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
   static gslc_tsXCheckbox sCheckbox##nElemId;                     \
   sCheckbox##nElemId.bRadio = bRadio_;                            \
   sCheckbox##nElemId.bChecked = bChecked_;                        \
   sCheckbox##nElemId.colCheck = colCheck_;                        \
   sCheckbox##nElemId.nStyle = nStyle_;                            \
+  sCheckbox##nElemId.pRadioNext = NULL;                           \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -270,15 +309,16 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
       0,                                                          \
       NULL,                                                       \
       (void*)(&sCheckbox##nElemId),                               \
-      NULL,                                                       \
       &gslc_ElemXCheckboxDraw,                                    \
       &gslc_ElemXCheckboxTouch,                                   \
       NULL,                                                       \
   };                                                              \
-  gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
-    (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
+  gslc_ElemXCheckboxRadioLink(pGui,                               \
+    gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,        \
+    (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL)));
 
-#endif
+#endif // GSLC_USE_PROGMEM
+#endif // !GSLC_FEATURE_COMPACT_ELEM
 
 
 #ifdef __cplusplus
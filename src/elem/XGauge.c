@@ -80,6 +80,11 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 //   and vertical / horizontal orientation.
 // ============================================================================
 
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XGAUGE_TYPE = {
+  GSLC_TYPEX_GAUGE,&gslc_ElemXGaugeDraw,NULL,NULL,NULL
+};
+
 // Create a gauge element and add it to the GUI element list
 // - Defines default styling for the element
 // - Defines callback for redraw but does not track touch/click
@@ -87,12 +92,22 @@ gslc_tsElemRef* gslc_ElemXGaugeCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   gslc_tsXGauge* pXData,gslc_tsRect rElem,
   int16_t nMin,int16_t nMax,int16_t nVal,gslc_tsColor colGauge,bool bVert)
 {
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXGaugeCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXGauge*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXGauge));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGaugeCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
   gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_GAUGE,rElem,NULL,0,GSLC_FONT_NONE);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
@@ -113,13 +128,24 @@ gslc_tsElemRef* gslc_ElemXGaugeCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
   pXData->nIndicLen       = 10;     // Dummy default to be overridden
   pXData->nIndicTip       = 3;      // Dummy default to be overridden
   pXData->bIndicFill      = false;
+  pXData->pIndicTbl       = NULL;
+  pXData->nIndicTblSteps  = 0;
+  pXData->bIndicLastValid = false;
+  pXData->nTickRad        = 0;
+  pXData->pRampTbl        = NULL;
+  pXData->nRampTblLen     = 0;
+  pXData->nRampW          = 0;
   sElem.pXData            = (void*)(pXData);
-  sElem.pfuncXDraw        = &gslc_ElemXGaugeDraw;
-  sElem.pfuncXTouch       = NULL;           // No need to track touches
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_GRAY;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XGAUGE_TYPE)) {
+    return NULL;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_GRAY;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -170,8 +196,63 @@ void gslc_ElemXGaugeSetIndicator(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_
   pGauge->nIndicTip   = nIndicTip;
   pGauge->bIndicFill  = bIndicFill;
 
+#if (GSLC_FEATURE_XGAUGE_RADIAL)
+  // Update the indicator geometry table (if enabled)
+  gslc_ElemXGaugeRadialCalcTbl(pGauge);
+#endif
+
+  // Just in case we were called at runtime, mark as needing redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
+void gslc_ElemXGaugeSetIndicatorTbl(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsPt* pIndicTbl,uint16_t nTblSteps)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGaugeSetIndicatorTbl";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+#if (GSLC_FEATURE_XGAUGE_RADIAL)
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXGauge*  pGauge  = (gslc_tsXGauge*)(pElem->pXData);
+
+  // Update the config
+  pGauge->pIndicTbl       = (nTblSteps > 0)? pIndicTbl : NULL;
+  pGauge->nIndicTblSteps  = (pIndicTbl != NULL)? nTblSteps : 0;
+
+  // Precompute the indicator geometry
+  gslc_ElemXGaugeRadialCalcTbl(pGauge);
+
+  // Just in case we were called at runtime, mark as needing redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+#else
+  GSLC_DEBUG_PRINT("ERROR: ElemXGaugeSetIndicatorTbl(%s) requires GSLC_FEATURE_XGAUGE_RADIAL=1\n","");
+#endif
+}
+
+void gslc_ElemXGaugeSetRampTbl(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsXGaugeRampCol* pRampTbl,uint16_t nTblLen)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGaugeSetRampTbl";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+#if (GSLC_FEATURE_XGAUGE_RAMP)
+  gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXGauge*  pGauge  = (gslc_tsXGauge*)(pElem->pXData);
+
+  // Update the config
+  pGauge->pRampTbl    = (nTblLen > 0)? pRampTbl : NULL;
+  pGauge->nRampTblLen = (pRampTbl != NULL)? nTblLen : 0;
+
+  // Precompute the ramp geometry for the current element size
+  gslc_ElemXGaugeRampCalc(pGauge,pElem->rElem.w,pElem->rElem.h);
+
   // Just in case we were called at runtime, mark as needing redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+#else
+  GSLC_DEBUG_PRINT("ERROR: ElemXGaugeSetRampTbl(%s) requires GSLC_FEATURE_XGAUGE_RAMP=1\n","");
+#endif
 }
 
 void gslc_ElemXGaugeSetTicks(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colTick,uint16_t nTickCnt,uint16_t nTickLen)
@@ -189,6 +270,9 @@ void gslc_ElemXGaugeSetTicks(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsCo
   pGauge->nTickCnt  = nTickCnt;
   pGauge->nTickLen  = nTickLen;
 
+  // Force the tick endpoints to be recalculated
+  pGauge->nTickRad  = 0;
+
   // Just in case we were called at runtime, mark as needing redraw
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
@@ -211,9 +295,8 @@ void gslc_ElemXGaugeUpdate(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nVa
   // Element needs redraw
   if (nVal != nValOld) {
     // We only need an incremental redraw
-    // NOTE: If the user configures the indicator to be
-    //       long enough that it overlaps some of the gauge indicators
-    //       then a full redraw should be done instead.
+    // - In radial mode, only the region covered by the old
+    //   indicator is erased and any overlapped ticks restored
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 
@@ -426,20 +509,20 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
     // Empty Region #1 (negative)
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nElemX1-nElemX0+1,nGaugeY0-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_COL_FILL(pGui,pElem));
     // Empty Region #2 (positive)
     rEmpty = (gslc_tsRect){nElemX0,nGaugeY1,nElemX1-nElemX0+1,nElemY1-nGaugeY1+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_COL_FILL(pGui,pElem));
   } else {
     // Empty Region #1 (negative)
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nGaugeX0-nElemX0+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_COL_FILL(pGui,pElem));
     // Empty Region #2 (positive)
     rEmpty = (gslc_tsRect){nGaugeX1,nElemY0,nElemX1-nGaugeX1+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,GSLC_ELEM_COL_FILL(pGui,pElem));
   }
 
   // Draw the gauge fill region
@@ -450,20 +533,23 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
 
   // Draw the midpoint line
   if (bVert) {
-    gslc_DrawLine(pGui, nElemX0, nElemY0+nGaugeMid, nElemX1, nElemY0+nGaugeMid, pElem->colElemFrame);
+    gslc_DrawLine(pGui, nElemX0, nElemY0+nGaugeMid, nElemX1, nElemY0+nGaugeMid, GSLC_ELEM_COL_FRAME(pGui,pElem));
   } else {
-    gslc_DrawLine(pGui, nElemX0+nGaugeMid, nElemY0, nElemX0+nGaugeMid, nElemY1, pElem->colElemFrame);
+    gslc_DrawLine(pGui, nElemX0+nGaugeMid, nElemY0, nElemX0+nGaugeMid, nElemY1, GSLC_ELEM_COL_FRAME(pGui,pElem));
   }
 
 
   // Draw a frame around the gauge
-  gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+  gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
 
   return true;
 }
 
 #if (GSLC_FEATURE_XGAUGE_RADIAL)
-void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,bool bFill,gslc_tsColor colFrame)
+
+// Calculate the indicator polygon vertices (relative to the dial center)
+// - Vertex order: base #1, tip base #1, tip base #2, base #2, tip
+void gslc_ElemXGaugeRadialCalcIndic(uint16_t nArrowLen,uint16_t nArrowSz,int16_t n64Ang,gslc_tsPt* asPt)
 {
   int16_t   nTipX,nTipY;
   int16_t   nBaseX1,nBaseY1,nBaseX2,nBaseY2;
@@ -474,30 +560,124 @@ void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16
   gslc_PolarToXY(nArrowSz,n64Ang-90*64,&nBaseX1,&nBaseY1);
   gslc_PolarToXY(nArrowSz,n64Ang+90*64,&nBaseX2,&nBaseY2);
 
+  asPt[0] = (gslc_tsPt){nBaseX1,nBaseY1};
+  asPt[1] = (gslc_tsPt){nBaseX1+nTipBaseX,nBaseY1+nTipBaseY};
+  asPt[2] = (gslc_tsPt){nBaseX2+nTipBaseX,nBaseY2+nTipBaseY};
+  asPt[3] = (gslc_tsPt){nBaseX2,nBaseY2};
+  asPt[4] = (gslc_tsPt){nTipX,nTipY};
+}
+
+// Precompute the indicator vertices for each angle step in the table
+void gslc_ElemXGaugeRadialCalcTbl(gslc_tsXGauge* pGauge)
+{
+  uint16_t  nStep;
+  int16_t   n64Ang;
+  if ((pGauge->pIndicTbl == NULL) || (pGauge->nIndicTblSteps == 0)) {
+    return;
+  }
+  for (nStep=0;nStep<pGauge->nIndicTblSteps;nStep++) {
+    n64Ang = (int32_t)nStep * 360*64 / pGauge->nIndicTblSteps;
+    gslc_ElemXGaugeRadialCalcIndic(pGauge->nIndicLen,pGauge->nIndicTip,n64Ang,
+      &(pGauge->pIndicTbl[nStep*XGAUGE_INDIC_PTS]));
+  }
+}
+
+// Fetch the indicator vertices for an angle and translate them
+// to the dial center, either from the precomputed table (if
+// enabled) or by direct calculation
+void gslc_ElemXGaugeRadialGetIndic(gslc_tsXGauge* pGauge,int16_t nX,int16_t nY,int16_t n64Ang,gslc_tsPt* asPt)
+{
+  uint8_t   nInd;
+  int32_t   nStep;
+  if (pGauge->pIndicTbl != NULL) {
+    // Round to the nearest table step (with wrap)
+    nStep = ((int32_t)n64Ang * pGauge->nIndicTblSteps + 180*64) / (360*64);
+    nStep = nStep % pGauge->nIndicTblSteps;
+    if (nStep < 0) {
+      nStep += pGauge->nIndicTblSteps;
+    }
+    for (nInd=0;nInd<XGAUGE_INDIC_PTS;nInd++) {
+      asPt[nInd] = pGauge->pIndicTbl[nStep*XGAUGE_INDIC_PTS+nInd];
+    }
+  } else {
+    gslc_ElemXGaugeRadialCalcIndic(pGauge->nIndicLen,pGauge->nIndicTip,n64Ang,asPt);
+  }
+  for (nInd=0;nInd<XGAUGE_INDIC_PTS;nInd++) {
+    asPt[nInd].x += nX;
+    asPt[nInd].y += nY;
+  }
+}
+
+// Calculate the endpoints of a tick mark (relative to the dial center)
+// - Matches the endpoints used by gslc_DrawLinePolar()
+static void gslc_ElemXGaugeRadialCalcTick(uint16_t nRadStart,uint16_t nRadEnd,int16_t n64Ang,gslc_tsPt* asPt)
+{
+  int16_t nSin = gslc_sinFX(n64Ang);
+  int16_t nCos = gslc_cosFX(n64Ang);
+  asPt[0].x =  (int32_t)nRadStart * nSin/32768;
+  asPt[0].y = -((int32_t)nRadStart * nCos/32768);
+  asPt[1].x =  (int32_t)nRadEnd   * nSin/32768;
+  asPt[1].y = -((int32_t)nRadEnd   * nCos/32768);
+}
+
+// Draw the tick marks around the dial
+// - If prTick is non-NULL, only the tick marks that intersect
+//   the region are drawn
+// - The tick endpoints are cached until the dial geometry changes
+static void gslc_ElemXGaugeRadialDrawTicks(gslc_tsGui* pGui,gslc_tsXGauge* pGauge,
+  int16_t nMidX,int16_t nMidY,uint16_t nRad,gslc_tsRect* prTick)
+{
+  uint16_t  nTickAng = 360 / pGauge->nTickCnt;
+  uint16_t  nTickNum = (360 + nTickAng - 1) / nTickAng;
+  bool      bCache   = (nTickNum <= XGAUGE_TICK_MAX);
+  uint16_t  nTick;
+  gslc_tsPt asPt[2];
+  int16_t   nX0,nY0,nX1,nY1;
+
+  if ((bCache) && (pGauge->nTickRad != nRad)) {
+    for (nTick=0;nTick<nTickNum;nTick++) {
+      gslc_ElemXGaugeRadialCalcTick(nRad-pGauge->nTickLen,nRad,nTick*nTickAng*64,&(pGauge->asTickPt[2*nTick]));
+    }
+    pGauge->nTickRad = nRad;
+  }
+
+  for (nTick=0;nTick<nTickNum;nTick++) {
+    if (bCache) {
+      asPt[0] = pGauge->asTickPt[2*nTick];
+      asPt[1] = pGauge->asTickPt[2*nTick+1];
+    } else {
+      gslc_ElemXGaugeRadialCalcTick(nRad-pGauge->nTickLen,nRad,nTick*nTickAng*64,asPt);
+    }
+    nX0 = nMidX+asPt[0].x; nY0 = nMidY+asPt[0].y;
+    nX1 = nMidX+asPt[1].x; nY1 = nMidY+asPt[1].y;
+    if (prTick != NULL) {
+      // Clip a copy of the endpoints so that the full tick is redrawn
+      int16_t nCX0 = nX0, nCY0 = nY0, nCX1 = nX1, nCY1 = nY1;
+      if (!gslc_ClipLine(prTick,&nCX0,&nCY0,&nCX1,&nCY1)) {
+        continue;
+      }
+    }
+    gslc_DrawLine(pGui,nX0,nY0,nX1,nY1,pGauge->colTick);
+  }
+}
+
+void gslc_ElemXGaugeDrawRadialHelp(gslc_tsGui* pGui,gslc_tsPt* asPt,bool bFill,gslc_tsColor colFrame)
+{
   if (!bFill) {
     // Framed
-    gslc_DrawLine(pGui,nX+nBaseX1,nY+nBaseY1,nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX2,nY+nBaseY2,nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY,nX+nTipX,nY+nTipY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY,nX+nTipX,nY+nTipY,colFrame);
-    gslc_DrawLine(pGui,nX+nBaseX1,nY+nBaseY1,nX+nBaseX2,nY+nBaseY2,colFrame);
+    gslc_DrawLine(pGui,asPt[0].x,asPt[0].y,asPt[1].x,asPt[1].y,colFrame);
+    gslc_DrawLine(pGui,asPt[3].x,asPt[3].y,asPt[2].x,asPt[2].y,colFrame);
+    gslc_DrawLine(pGui,asPt[1].x,asPt[1].y,asPt[4].x,asPt[4].y,colFrame);
+    gslc_DrawLine(pGui,asPt[2].x,asPt[2].y,asPt[4].x,asPt[4].y,colFrame);
+    gslc_DrawLine(pGui,asPt[0].x,asPt[0].y,asPt[3].x,asPt[3].y,colFrame);
 
   } else {
     // Filled
-    gslc_tsPt asPt[4];
-
-    // Main body of pointer
-    asPt[0] = (gslc_tsPt){nX+nBaseX1,nY+nBaseY1};
-    asPt[1] = (gslc_tsPt){nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY};
-    asPt[2] = (gslc_tsPt){nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY};
-    asPt[3] = (gslc_tsPt){nX+nBaseX2,nY+nBaseY2};
+    // - Main body of pointer
     gslc_DrawFillQuad(pGui,asPt,colFrame);
 
-    // Tip of pointer
-    asPt[0] = (gslc_tsPt){nX+nBaseX1+nTipBaseX,nY+nBaseY1+nTipBaseY};
-    asPt[1] = (gslc_tsPt){nX+nTipX,nY+nTipY};
-    asPt[2] = (gslc_tsPt){nX+nBaseX2+nTipBaseX,nY+nBaseY2+nTipBaseY};
-    gslc_DrawFillTriangle(pGui,asPt[0].x,asPt[0].y,asPt[1].x,asPt[1].y,asPt[2].x,asPt[2].y,colFrame);
+    // - Tip of pointer
+    gslc_DrawFillTriangle(pGui,asPt[1].x,asPt[1].y,asPt[4].x,asPt[4].y,asPt[2].x,asPt[2].y,colFrame);
 
   }
 
@@ -525,16 +705,11 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
   int16_t   nMin            = pGauge->nMin;
   int16_t   nRng            = pGauge->nMax - pGauge->nMin;
   int16_t   nVal            = pGauge->nVal;
-  int16_t   nValLast        = pGauge->nValLast;
-  bool      bValLastValid   = pGauge->bValLastValid;
-  uint16_t  nTickLen        = pGauge->nTickLen;
-  uint16_t  nTickAng        = 360 / pGauge->nTickCnt;
-  uint16_t  nArrowLen       = pGauge->nIndicLen;
-  uint16_t  nArrowSize      = pGauge->nIndicTip;
   bool      bFill           = pGauge->bIndicFill;
 
-  int16_t   n64Ang,n64AngLast;
+  int16_t   n64Ang;
   int16_t   nInd;
+  gslc_tsPt asPt[XGAUGE_INDIC_PTS];
 
 
   if (nRng == 0) {
@@ -546,34 +721,156 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
   // TODO: Clean up excess integer typecasting
   if (pGauge->bFlip) {
     n64Ang      = (int32_t)(nMax - nVal    )* 360*64 /nRng;
-    n64AngLast  = (int32_t)(nMax - nValLast)* 360*64 /nRng;
   } else {
     n64Ang      = (int32_t)(nVal     - nMin)* 360*64 /nRng;
-    n64AngLast  = (int32_t)(nValLast - nMin)* 360*64 /nRng;
-  }
-
-  // Clear old
-  if (bValLastValid) {
-    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
   }
 
-  // Draw frame
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFill);  // Erase first
-    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFrame);
-    for (nInd=0;nInd<360;nInd+=nTickAng) {
-      gslc_DrawLinePolar(pGui,nElemMidX,nElemMidY,nElemRad-nTickLen,nElemRad,nInd*64,pGauge->colTick);
+    // Draw frame
+    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,GSLC_ELEM_COL_FILL(pGui,pElem));  // Erase first
+    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,GSLC_ELEM_COL_FRAME(pGui,pElem));
+    gslc_ElemXGaugeRadialDrawTicks(pGui,pGauge,nElemMidX,nElemMidY,nElemRad,NULL);
+  } else if (pGauge->bIndicLastValid) {
+    // Clear old indicator
+    // - If the indicator's bounding box lies within the dial then
+    //   we can simply erase the box. Otherwise, retrace the old
+    //   indicator with the fill color.
+    gslc_tsRect rLast = pGauge->rIndicLast;
+    int32_t     nDX0 = rLast.x - nElemMidX;
+    int32_t     nDY0 = rLast.y - nElemMidY;
+    int32_t     nDX1 = rLast.x + rLast.w - 1 - nElemMidX;
+    int32_t     nDY1 = rLast.y + rLast.h - 1 - nElemMidY;
+    int32_t     nRadSq = (int32_t)(nElemRad-1)*(nElemRad-1);
+    nDX0 *= nDX0; nDY0 *= nDY0; nDX1 *= nDX1; nDY1 *= nDY1;
+    if ((nDX0+nDY0 < nRadSq) && (nDX0+nDY1 < nRadSq) &&
+        (nDX1+nDY0 < nRadSq) && (nDX1+nDY1 < nRadSq)) {
+      gslc_DrawFillRect(pGui,rLast,GSLC_ELEM_COL_FILL(pGui,pElem));
+    } else {
+      gslc_ElemXGaugeDrawRadialHelp(pGui,pGauge->asIndicLast,bFill,GSLC_ELEM_COL_FILL(pGui,pElem));
     }
+
+    // Restore any tick marks that were covered by the old indicator
+    // - Expand the region slightly to account for the pixels of a
+    //   tick line lying just outside its ideal segment
+    gslc_tsRect rTick = gslc_ExpandRect(rLast,2,2);
+    gslc_ElemXGaugeRadialDrawTicks(pGui,pGauge,nElemMidX,nElemMidY,nElemRad,&rTick);
   }
 
   // Draw pointer
-  gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64Ang,bFill,pGauge->colGauge);
+  gslc_ElemXGaugeRadialGetIndic(pGauge,nElemMidX,nElemMidY,n64Ang,asPt);
+  gslc_ElemXGaugeDrawRadialHelp(pGui,asPt,bFill,pGauge->colGauge);
+
+  // Save the indicator geometry to support incremental erase
+  int16_t nMinX = asPt[0].x;
+  int16_t nMaxX = asPt[0].x;
+  int16_t nMinY = asPt[0].y;
+  int16_t nMaxY = asPt[0].y;
+  for (nInd=0;nInd<XGAUGE_INDIC_PTS;nInd++) {
+    pGauge->asIndicLast[nInd] = asPt[nInd];
+    nMinX = (asPt[nInd].x < nMinX)? asPt[nInd].x : nMinX;
+    nMaxX = (asPt[nInd].x > nMaxX)? asPt[nInd].x : nMaxX;
+    nMinY = (asPt[nInd].y < nMinY)? asPt[nInd].y : nMinY;
+    nMaxY = (asPt[nInd].y > nMaxY)? asPt[nInd].y : nMaxY;
+  }
+  pGauge->rIndicLast = (gslc_tsRect){nMinX,nMinY,nMaxX-nMinX+1,nMaxY-nMinY+1};
+  pGauge->bIndicLastValid = true;
 
   return true;
 }
 #endif // GSLC_FEATURE_XGAUGE_RADIAL
 
 #ifdef GSLC_FEATURE_XGAUGE_RAMP
+// Calculate the height and color segment of a ramp column
+// - nX is the column offset from the left side of the element
+static void gslc_ElemXGaugeRampCalcCol(uint16_t nElemW,uint16_t nElemH,uint16_t nX,gslc_tsXGaugeRampCol* pCol)
+{
+  uint32_t  nSclFX;
+  int32_t   nHeightTmp;
+  int16_t   nInd;
+  uint16_t  nBlockLen,nSegLen,nSegInd,nSegOffset;
+
+  nSclFX = (uint32_t)nElemH*32767/(nElemW*nElemW);
+  nInd = nElemW-nX;
+  nHeightTmp = nSclFX * nInd*nInd /32767;
+  pCol->nHeight = nElemH-nHeightTmp;
+
+  nBlockLen = (nElemW-(XGAUGE_RAMP_STEPS-1)*XGAUGE_RAMP_GAP)/XGAUGE_RAMP_STEPS;
+  nSegLen = nBlockLen + XGAUGE_RAMP_GAP;
+  nSegInd = nX/nSegLen;
+  nSegOffset = nX % nSegLen;
+  if (nSegOffset > nBlockLen) {
+    // Inside gap
+    pCol->nSeg = XGAUGE_RAMP_SEG_GAP;
+  } else if (nSegInd > XGAUGE_RAMP_STEPS) {
+    // Clamp any remainder columns to the last cached segment color
+    pCol->nSeg = XGAUGE_RAMP_STEPS;
+  } else {
+    pCol->nSeg = (uint8_t)nSegInd;
+  }
+}
+
+void gslc_ElemXGaugeRampCalc(gslc_tsXGauge* pGauge,uint16_t nElemW,uint16_t nElemH)
+{
+  if (pGauge == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGaugeRampCalc";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  if (nElemW == 0) {
+    pGauge->nRampW = 0;
+    return;
+  }
+
+  // Precompute the color of each segment
+  // - The color is sampled at the start of each segment
+  uint16_t  nBlockLen,nSegLen,nSegInd,nColInd;
+  nBlockLen = (nElemW-(XGAUGE_RAMP_STEPS-1)*XGAUGE_RAMP_GAP)/XGAUGE_RAMP_STEPS;
+  nSegLen = nBlockLen + XGAUGE_RAMP_GAP;
+  for (nSegInd=0;nSegInd<=XGAUGE_RAMP_STEPS;nSegInd++) {
+    nColInd = (uint32_t)nSegInd*nSegLen*1000/nElemW;
+    pGauge->acolRampSeg[nSegInd] = gslc_ColorBlend3(GSLC_COL_GREEN,GSLC_COL_YELLOW,GSLC_COL_RED,500,nColInd);
+  }
+
+  // Precompute the column geometry (if a table has been provided)
+  uint16_t  nX;
+  if ((pGauge->pRampTbl != NULL) && (pGauge->nRampTblLen >= nElemW)) {
+    for (nX=0;nX<nElemW;nX++) {
+      gslc_ElemXGaugeRampCalcCol(nElemW,nElemH,nX,&(pGauge->pRampTbl[nX]));
+    }
+  }
+
+  pGauge->nRampW = nElemW;
+  pGauge->nRampH = nElemH;
+}
+
+// Fetch the geometry of a ramp column
+// - Uses the precomputed table if enabled, otherwise calculates it
+static void gslc_ElemXGaugeRampGetCol(gslc_tsXGauge* pGauge,bool bTblEn,uint16_t nElemW,uint16_t nElemH,
+  uint16_t nX,gslc_tsXGaugeRampCol* pCol)
+{
+  if (bTblEn) {
+    *pCol = pGauge->pRampTbl[nX];
+  } else {
+    gslc_ElemXGaugeRampCalcCol(nElemW,nElemH,nX,pCol);
+  }
+}
+
+// Get the height above the element bottom where a ramp column ends
+static uint16_t gslc_ElemXGaugeRampColBot(gslc_tsXGaugeRampCol* pCol)
+{
+  return (pCol->nHeight >= 20)? pCol->nHeight-20 : 0;
+}
+
+// Get the color of a ramp column
+static gslc_tsColor gslc_ElemXGaugeRampColColor(gslc_tsXGauge* pGauge,gslc_tsXGaugeRampCol* pCol,
+  bool bModeErase,gslc_tsColor colFill)
+{
+  if ((bModeErase) || (pCol->nSeg == XGAUGE_RAMP_SEG_GAP)) {
+    return colFill;
+  }
+  return pGauge->acolRampSeg[pCol->nSeg];
+}
+
 bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawType eRedraw)
 {
   gslc_tsElem*    pElem = gslc_GetElemFromRef(pGui,pElemRef);
@@ -592,19 +889,23 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   int16_t   nVal            = pGauge->nVal;
   int16_t   nValLast        = pGauge->nValLast;
   bool      bValLastValid   = pGauge->bValLastValid;
-  int16_t   nInd;
 
   if (nRng == 0) {
     GSLC_DEBUG_PRINT("ERROR: gslc_ElemXGaugeDrawRamp() Zero range [%d,%d]\n",nMin,nMax);
     return false;
   }
 
-  uint32_t  nSclFX;
-  uint16_t  nHeight;
-  int32_t   nHeightTmp;
-  uint16_t  nHeightBot;
+  // Recompute the segment colors and column table if the
+  // element has been resized since the last calculation
+  if ((pGauge->nRampW != nElemW) || (pGauge->nRampH != nElemH)) {
+    gslc_ElemXGaugeRampCalc(pGauge,nElemW,nElemH);
+  }
+  bool      bTblEn = (pGauge->pRampTbl != NULL) && (pGauge->nRampTblLen >= nElemW);
+
+  gslc_tsXGaugeRampCol  sCol;
+#if !(DRV_HAS_DRAW_SPANS)
   uint16_t  nX;
-  uint16_t  nColInd;
+#endif
 
   // Calculate region to draw or clear
   bool      bModeErase;
@@ -644,51 +945,89 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   nPosXStart  = (nValStart - nMin)*nElemW/nRng;
   nPosXEnd    = (nValEnd   - nMin)*nElemW/nRng;
 
-  nSclFX = (uint32_t)nElemH*32767/(nElemW*nElemW);
-
-  for (nX=nPosXStart;nX<nPosXEnd;nX++) {
-    nInd = nElemW-nX;
-    nHeightTmp = nSclFX * nInd*nInd /32767;
-    nHeight = nElemH-nHeightTmp;
-    if (nHeight >= 20) {
-      nHeightBot = nHeight-20;
-    } else {
-      nHeightBot = 0;
-    }
-    gslc_tsColor  nCol;
-    uint16_t      nSteps = 10;
-    uint16_t      nGap = 3;
-
-    if (nSteps == 0) {
-      nColInd = nX*1000/nElemW;
-      nCol = gslc_ColorBlend3(GSLC_COL_GREEN,GSLC_COL_YELLOW,GSLC_COL_RED,500,nColInd);
-    } else {
-      uint16_t  nBlockLen,nSegLen,nSegInd,nSegOffset,nSegStart;
-      nBlockLen = (nElemW-(nSteps-1)*nGap)/nSteps;
-      nSegLen = nBlockLen + nGap;
-      nSegInd = nX/nSegLen;
-      nSegOffset = nX % nSegLen;
-      nSegStart = nSegInd * nSegLen;
-
-      if (nSegOffset <= nBlockLen) {
-        // Inside block
-        nColInd = (uint32_t)nSegStart*1000/nElemW;
-        nCol = gslc_ColorBlend3(GSLC_COL_GREEN,GSLC_COL_YELLOW,GSLC_COL_RED,500,nColInd);
-
-      } else {
-        // Inside gap
-        // - No draw
-        nCol = pElem->colElemFill;
+#if (DRV_HAS_DRAW_SPANS)
+  // Draw each run of equally colored columns as a batch of
+  // horizontal spans submitted to the driver in one call
+  // - The column tops and bottoms are both monotonic across the
+  //   ramp, so the columns of a run that cover any given row are
+  //   contiguous and form a single span
+  // - The column geometry is fetched from the precomputed table
+  //   if available, otherwise it is calculated on the fly
+  gslc_tsColor  nCol;
+  gslc_tsColor  colFill = GSLC_ELEM_COL_FILL(pGui,pElem);
+  gslc_tsSpan   asSpan[XGAUGE_RAMP_SPAN_MAX];
+  uint16_t      nSpanCnt;
+  int16_t       nXa,nXb,nXL,nXR,nY,nYTop,nYBot;
+
+  nXa = nPosXStart;
+  while (nXa < nPosXEnd) {
+    // Find the columns in the run
+    gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nXa,&sCol);
+    nCol = gslc_ElemXGaugeRampColColor(pGauge,&sCol,bModeErase,colFill);
+    nYBot = nElemY1 - gslc_ElemXGaugeRampColBot(&sCol);
+    for (nXb=nXa+1;nXb<nPosXEnd;nXb++) {
+      gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nXb,&sCol);
+      if (!gslc_ColorEqual(gslc_ElemXGaugeRampColColor(pGauge,&sCol,bModeErase,colFill),nCol)) {
+        break;
       }
-
     }
-
-    if (bModeErase) {
-      nCol = pElem->colElemFill;
+    gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nXb-1,&sCol);
+    nYTop = nElemY1 - sCol.nHeight;
+
+    // Walk the rows upwards, tracking the first (nXL) and
+    // last (nXR) column in the run that covers the row
+    nSpanCnt = 0;
+    nXL = nXa;
+    nXR = nXa-1;
+    for (nY=nYBot;nY>=nYTop;nY--) {
+      while (nXR+1 < nXb) {
+        gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nXR+1,&sCol);
+        if (nElemY1 - gslc_ElemXGaugeRampColBot(&sCol) < nY) {
+          break;
+        }
+        nXR++;
+      }
+      while (nXL <= nXR) {
+        gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nXL,&sCol);
+        if (nElemY1 - (int16_t)sCol.nHeight <= nY) {
+          break;
+        }
+        nXL++;
+      }
+      if (nXL <= nXR) {
+        asSpan[nSpanCnt] = (gslc_tsSpan){nElemX0+nXL,nY,(uint16_t)(nXR-nXL+1)};
+        nSpanCnt++;
+        if (nSpanCnt == XGAUGE_RAMP_SPAN_MAX) {
+          gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
+          nSpanCnt = 0;
+        }
+      }
     }
-    gslc_DrawLine(pGui,nElemX0+nX,nElemY1-nHeightBot,nElemX0+nX,nElemY1-nHeight,nCol);
+    gslc_DrawFillSpans(pGui,asSpan,nSpanCnt,nCol);
 
+    nXa = nXb;
+  }
+#else
+  // Draw each column as a single vertical span
+  // - The column geometry is fetched from the precomputed table
+  //   if available, otherwise it is calculated on the fly
+  // - The span is submitted as a 1-pixel wide filled rectangle
+  //   which avoids the per-pixel line emulation in drivers that
+  //   don't provide a native line primitive
+  gslc_tsColor  nCol;
+  gslc_tsColor  colFill = GSLC_ELEM_COL_FILL(pGui,pElem);
+  gslc_tsRect   rSpan;
+  for (nX=nPosXStart;nX<nPosXEnd;nX++) {
+    gslc_ElemXGaugeRampGetCol(pGauge,bTblEn,nElemW,nElemH,nX,&sCol);
+    nCol = gslc_ElemXGaugeRampColColor(pGauge,&sCol,bModeErase,colFill);
+
+    rSpan.x = nElemX0+nX;
+    rSpan.y = nElemY1-sCol.nHeight;
+    rSpan.w = 1;
+    rSpan.h = sCol.nHeight-gslc_ElemXGaugeRampColBot(&sCol)+1;
+    gslc_DrawFillRect(pGui,rSpan,nCol);
   }
+#endif // DRV_HAS_DRAW_SPANS
 
   return true;
 }
@@ -50,6 +50,27 @@ extern "C" {
 #define  GSLC_TYPEX_GAUGE GSLC_TYPE_BASE_EXTEND + 0
 
 
+/// Number of vertices in the radial gauge indicator polygon
+#define XGAUGE_INDIC_PTS  5
+
+/// Maximum number of radial gauge tick marks with cached endpoints
+/// - Gauges with more tick marks calculate the endpoints on each redraw
+#if !defined(XGAUGE_TICK_MAX)
+  #define XGAUGE_TICK_MAX 16
+#endif
+
+/// Ramp gauge segmentation
+#define XGAUGE_RAMP_STEPS 10  ///< Number of colored segments in ramp
+#define XGAUGE_RAMP_GAP   3   ///< Gap between ramp segments (pixels)
+#define XGAUGE_RAMP_SEG_GAP 0xFF  ///< Ramp column segment index for gap
+#define XGAUGE_RAMP_SPAN_MAX 16   ///< Number of ramp spans submitted per driver call
+
+/// Precomputed geometry for a ramp gauge column
+typedef struct {
+  uint16_t            nHeight;        ///< Column height (pixels)
+  uint8_t             nSeg;           ///< Segment index (or XGAUGE_RAMP_SEG_GAP)
+} gslc_tsXGaugeRampCol;
+
 /// Gauge drawing style
 typedef enum {
     GSLCX_GAUGE_STYLE_PROG_BAR,  ///< Progress bar
@@ -85,6 +106,22 @@ typedef struct {
   uint16_t            nIndicTip;      ///< Size of tip at end of indicator
   bool                bIndicFill;     ///< Fill the indicator if true
 
+  // Radial indicator state
+  gslc_tsPt*          pIndicTbl;      ///< Optional table of indicator vertices per angle step (or NULL)
+  uint16_t            nIndicTblSteps; ///< Number of angle steps in indicator table
+  gslc_tsPt           asIndicLast[XGAUGE_INDIC_PTS]; ///< Indicator vertices at last redraw
+  gslc_tsRect         rIndicLast;     ///< Bounding box of indicator at last redraw
+  bool                bIndicLastValid;///< Indicator state from last redraw is valid?
+  gslc_tsPt           asTickPt[2*XGAUGE_TICK_MAX]; ///< Tick mark endpoints (relative to dial center)
+  uint16_t            nTickRad;       ///< Dial radius used for tick endpoints (0 if not calculated)
+
+  // Ramp state
+  gslc_tsXGaugeRampCol* pRampTbl;     ///< Optional table of ramp column geometry (or NULL)
+  uint16_t            nRampTblLen;    ///< Number of columns in ramp table
+  uint16_t            nRampW;         ///< Element width used for ramp precalculation (0 if none)
+  uint16_t            nRampH;         ///< Element height used for ramp precalculation
+  gslc_tsColor        acolRampSeg[XGAUGE_RAMP_STEPS+1]; ///< Precomputed ramp segment colors (incl. remainder)
+
 } gslc_tsXGauge;
 
 
@@ -102,6 +139,7 @@ typedef struct {
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining gauge size
 /// \param[in]  nMin:        Minimum value of gauge for nVal comparison
 /// \param[in]  nMax:        Maximum value of gauge for nVal comparison
@@ -146,6 +184,49 @@ void gslc_ElemXGaugeSetIndicator(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_
         uint16_t nIndicLen,uint16_t nIndicTip,bool bIndicFill);
 
 
+///
+/// Assign a table to cache the radial indicator geometry
+/// - The indicator vertices are precomputed for each of nTblSteps
+///   angles around the dial so that redraws don't need to perform
+///   any polar coordinate transforms
+/// - The indicator angle is rounded to the nearest table step, so
+///   360 steps provides one degree of resolution
+/// - The table is recomputed whenever the indicator is reconfigured
+///   with gslc_ElemXGaugeSetIndicator()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pIndicTbl:   Ptr to table storage (already allocated)
+///                          with size (nTblSteps*XGAUGE_INDIC_PTS) points,
+///                          or NULL to disable the table
+/// \param[in]  nTblSteps:   Number of angle steps in the table
+///
+/// \return none
+///
+void gslc_ElemXGaugeSetIndicatorTbl(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsPt* pIndicTbl,uint16_t nTblSteps);
+
+
+///
+/// Assign a table to cache the ramp gauge column geometry
+/// - The height and color segment of every column are precomputed
+///   so that redraws only need to perform table lookups
+/// - The table is recomputed automatically if the element is resized
+/// - If the table is shorter than the element width, the
+///   geometry is calculated during redraw instead
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pRampTbl:    Ptr to table storage (already allocated)
+///                          with nTblLen entries, or NULL to disable
+///                          the table
+/// \param[in]  nTblLen:     Number of columns in the table (should be
+///                          at least the element width)
+///
+/// \return none
+///
+void gslc_ElemXGaugeSetRampTbl(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsXGaugeRampCol* pRampTbl,uint16_t nTblLen);
+
+
 ///
 /// Configure the appearance of the Gauge ticks
 ///
@@ -225,6 +306,16 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
 /// \return true if success, false otherwise
 ///
 bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawType eRedraw);
+
+///
+/// Helper function to precompute the radial indicator table
+/// - Called when the indicator or its table is configured
+///
+/// \param[in]  pGauge:      Ptr to Gauge extended data
+///
+/// \return none
+///
+void gslc_ElemXGaugeRadialCalcTbl(gslc_tsXGauge* pGauge);
 #endif
 
 #if (GSLC_FEATURE_XGAUGE_RAMP)
@@ -239,6 +330,19 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
 /// \return true if success, false otherwise
 ///
 bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawType eRedraw);
+
+///
+/// Helper function to precompute the ramp segment colors and
+/// column geometry table for the current element size
+/// - Called from gslc_ElemXGaugeDrawRamp() when the size changes
+///
+/// \param[in]  pGauge:      Ptr to Gauge extended data
+/// \param[in]  nElemW:      Element width
+/// \param[in]  nElemH:      Element height
+///
+/// \return none
+///
+void gslc_ElemXGaugeRampCalc(gslc_tsXGauge* pGauge,uint16_t nElemW,uint16_t nElemH);
 #endif
 
 // ============================================================================
@@ -276,6 +380,8 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
 ///
 
 
+// - Not available in the compact element layout (GSLC_FEATURE_COMPACT_ELEM)
+#if !(GSLC_FEATURE_COMPACT_ELEM)
 #if (GSLC_USE_PROGMEM)
 
 
@@ -299,6 +405,12 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
+  sGauge##nElemId.pIndicTbl = NULL;                               \
+  sGauge##nElemId.nIndicTblSteps = 0;                             \
+  sGauge##nElemId.bIndicLastValid = false;                        \
+  sGauge##nElemId.pRampTbl = NULL;                                \
+  sGauge##nElemId.nRampTblLen = 0;                                \
+  sGauge##nElemId.nRampW = 0;                                     \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -318,7 +430,6 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       0,                                                          \
       NULL,                                                       \
       (void*)(&sGauge##nElemId),                                  \
-      NULL,                                                       \
       &gslc_ElemXGaugeDraw,                                       \
       NULL,                                                       \
       NULL,                                                       \
@@ -349,6 +460,12 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
+  sGauge##nElemId.pIndicTbl = NULL;                               \
+  sGauge##nElemId.nIndicTblSteps = 0;                             \
+  sGauge##nElemId.bIndicLastValid = false;                        \
+  sGauge##nElemId.pRampTbl = NULL;                                \
+  sGauge##nElemId.nRampTblLen = 0;                                \
+  sGauge##nElemId.nRampW = 0;                                     \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -368,7 +485,6 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       0,                                                          \
       NULL,                                                       \
       (void*)(&sGauge##nElemId),                                  \
-      NULL,                                                       \
       &gslc_ElemXGaugeDraw,                                       \
       NULL,                                                       \
       NULL,                                                       \
@@ -376,7 +492,8 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
-#endif
+#endif // GSLC_USE_PROGMEM
+#endif // !GSLC_FEATURE_COMPACT_ELEM
 
 #ifdef __cplusplus
 }
@@ -73,16 +73,38 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 
 // ============================================================================
 
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XGRAPH_TYPE = {
+  GSLC_TYPEX_GRAPH,&gslc_ElemXGraphDraw,NULL,NULL,NULL
+};
+
 gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
   gslc_tsXGraph* pXData,gslc_tsRect rElem,int16_t nFontId,int16_t* pBuf,
   uint16_t nBufMax,gslc_tsColor colGraph)
 {
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXGraphCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXGraph*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXGraph));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXGraphCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
+  if (pBuf == NULL) {
+    // Allocate the data buffer from the extended data arena
+    pBuf = (int16_t*)gslc_XDataArenaAlloc(pGui,nPage,nBufMax*sizeof(int16_t));
+    if (pBuf == NULL) {
+      return NULL;
+    }
+  }
   gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_GRAPH,rElem,NULL,0,nFontId);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
@@ -135,13 +157,16 @@ gslc_tsElemRef* gslc_ElemXGraphCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t n
 
   sElem.pXData            = (void*)(pXData);
 
-  // Specify the custom drawing callback
-  sElem.pfuncXDraw        = &gslc_ElemXGraphDraw;
-  sElem.pfuncXTouch       = NULL;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XGRAPH_TYPE)) {
+    return NULL;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -272,7 +297,7 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
     }
   }
 
@@ -281,7 +306,7 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   //       erase the inner region. Instead we would just erase
   //       old values and redraw new ones
   gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
-  gslc_DrawFillRect(pGui,rInner,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+  gslc_DrawFillRect(pGui,rInner,(bGlow)?GSLC_ELEM_COL_FILL_GLOW(pGui,pElem):GSLC_ELEM_COL_FILL(pGui,pElem));
 
   int16_t           nDataVal;
   uint16_t          nCurX = 0;
@@ -94,10 +94,12 @@ typedef struct {
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining checkbox size
 /// \param[in]  nFontId:     Font ID to use for graph area
 /// \param[in]  pBuf:        Ptr to data buffer (already allocated)
-///                          with size (nBufMax) int16_t
+///                          with size (nBufMax) int16_t, or NULL to
+///                          allocate from the extended data arena
 /// \param[in]  nBufRows:    Maximum number of points in buffer
 /// \param[in]  colGraph:    Color of the graph
 ///
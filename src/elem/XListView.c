@@ -0,0 +1,575 @@
+// =======================================================================
+// GUIslice library (extensions)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2019 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file XListView.c
+
+
+
+// GUIslice library
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include "elem/XListView.h"
+
+#include <stdio.h>
+
+#if (GSLC_USE_PROGMEM)
+    #include <avr/pgmspace.h>
+#endif
+
+// ----------------------------------------------------------------------------
+// Error Messages
+// ----------------------------------------------------------------------------
+
+extern const char GSLC_PMEM ERRSTR_NULL[];
+extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
+
+
+// ============================================================================
+// Extended Element: ListView
+// - A virtualized list of selectable rows. The row content is
+//   fetched from a data-source callback only when a visible row
+//   needs to be drawn.
+// - Scrolling moves the rows that remain visible with a display
+//   copy (where supported by the driver) and only the newly
+//   exposed rows are drawn.
+// ============================================================================
+
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XLISTVIEW_TYPE = {
+  GSLC_TYPEX_LISTVIEW,&gslc_ElemXListViewDraw,&gslc_ElemXListViewTouch,NULL,NULL
+};
+
+// Create a list view element and add it to the GUI element list
+// - Defines default styling for the element
+// - Defines callback for redraw and touch
+gslc_tsElemRef* gslc_ElemXListViewCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
+  gslc_tsXListView* pXData,gslc_tsRect rElem,int16_t nFontId,uint8_t nRowH,
+  uint16_t nRowCnt,GSLC_CB_XLISTVIEW_GETROW pfuncGetRow)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXListView*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXListView));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
+  gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
+  gslc_tsElemRef* pElemRef = NULL;
+  sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_LISTVIEW,rElem,NULL,0,nFontId);
+  sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
+  sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
+  sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
+  sElem.nFeatures        &= ~GSLC_ELEM_FEA_GLOW_EN;
+  // Default group assignment. Can override later with ElemSetGroup()
+  sElem.nGroup            = GSLC_GROUP_ID_NONE;
+
+  // Define other extended data
+  pXData->nRowCnt         = (nRowCnt > XLISTVIEW_ROW_MAX)? XLISTVIEW_ROW_MAX : nRowCnt;
+  pXData->nMarginX        = 5;
+  pXData->colSelFill      = GSLC_COL_BLUE_DK2;
+  pXData->colSelText      = GSLC_COL_WHITE;
+  pXData->nRowTop         = 0;
+  pXData->nSel            = XLISTVIEW_SEL_NONE;
+  pXData->bLastValid      = false;
+  pXData->nRowTopLast     = 0;
+  pXData->nSelLast        = XLISTVIEW_SEL_NONE;
+  pXData->nRowCntLast     = 0;
+  pXData->pfuncXGetRow    = pfuncGetRow;
+  pXData->pfuncXSel       = NULL;
+
+  // Precalculate the row layout
+  // - Fetch the text height and offsets based on characters that
+  //   are likely to maximize the ascenders / descenders
+  int16_t       nChOffsetX,nChOffsetY;
+  uint16_t      nChSzW,nChSzH;
+  char          acMonoH[3] = "p$";
+
+  gslc_DrvGetTxtSize(pGui, GSLC_ELEM_TXT_FONT(pGui,&sElem), (char*)&acMonoH, sElem.eTxtFlags, &nChOffsetX, &nChOffsetY, &nChSzW, &nChSzH);
+
+  if (nRowH == 0) {
+    nRowH = nChSzH + 2;
+  }
+  pXData->nRowH       = nRowH;
+  // - The number of window rows is limited to its 8-bit range; any
+  //   remaining space below the rows is filled when drawn
+  uint16_t      nWndRows = (rElem.h > 2)? (rElem.h - 2) / nRowH : 0;
+  pXData->nWndRows    = (nWndRows > 255)? 255 : (uint8_t)nWndRows;
+
+  // Vertically center the text within each row and
+  // correct for character offsets
+  pXData->nTxtOffsetX = nChOffsetX;
+  pXData->nTxtOffsetY = ((int16_t)nRowH - (int16_t)nChSzH) / 2 - nChOffsetY;
+
+  sElem.pXData            = (void*)(pXData);
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XLISTVIEW_TYPE)) {
+    return NULL;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
+  if (nPage != GSLC_PAGE_NONE) {
+    pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
+    return pElemRef;
+#if (GSLC_FEATURE_COMPOUND)
+  } else {
+    // Save as temporary element
+    pGui->sElemTmp = sElem;
+    pGui->sElemRefTmp.pElem = &(pGui->sElemTmp);
+    pGui->sElemRefTmp.eElemFlags = GSLC_ELEMREF_DEFAULT | GSLC_ELEMREF_REDRAW_FULL;
+    return &(pGui->sElemRefTmp);
+#endif
+  }
+  return NULL;
+}
+
+
+// Clamp the top row so that the window doesn't extend past the last row
+static uint16_t gslc_ElemXListViewClampTop(gslc_tsXListView* pListView,uint16_t nRowTop)
+{
+  uint16_t nRowTopMax = 0;
+  if (pListView->nRowCnt > pListView->nWndRows) {
+    nRowTopMax = pListView->nRowCnt - pListView->nWndRows;
+  }
+  return (nRowTop > nRowTopMax)? nRowTopMax : nRowTop;
+}
+
+
+void gslc_ElemXListViewSetRowCnt(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nRowCnt)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewSetRowCnt";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+
+  // Rows beyond the range of the selection index are not accessible
+  if (nRowCnt > XLISTVIEW_ROW_MAX) {
+    nRowCnt = XLISTVIEW_ROW_MAX;
+  }
+  if (nRowCnt == pListView->nRowCnt) {
+    return;
+  }
+  pListView->nRowCnt = nRowCnt;
+
+  // Drop the selection if the row no longer exists
+  if (pListView->nSel >= (int32_t)nRowCnt) {
+    gslc_ElemXListViewSetSel(pGui,pElemRef,XLISTVIEW_SEL_NONE);
+  }
+
+  // Keep the window within the list
+  pListView->nRowTop = gslc_ElemXListViewClampTop(pListView,pListView->nRowTop);
+
+  // Only need incremental redraw
+  // - The redraw determines which visible rows were affected
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+}
+
+uint16_t gslc_ElemXListViewGetRowCnt(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewGetRowCnt";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+  return pListView->nRowCnt;
+}
+
+void gslc_ElemXListViewSetTop(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nRowTop)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewSetTop";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+
+  nRowTop = gslc_ElemXListViewClampTop(pListView,nRowTop);
+  if (nRowTop != pListView->nRowTop) {
+    pListView->nRowTop = nRowTop;
+    // Only need incremental redraw
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+  }
+}
+
+uint16_t gslc_ElemXListViewGetTop(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewGetTop";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+  return pListView->nRowTop;
+}
+
+void gslc_ElemXListViewSetSel(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nSel)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewSetSel";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+
+  // Clip selection
+  if ((nSel < 0) || (pListView->nRowCnt == 0)) {
+    nSel = XLISTVIEW_SEL_NONE;
+  } else if (nSel >= (int32_t)pListView->nRowCnt) {
+    nSel = pListView->nRowCnt - 1;
+  }
+
+  // Only update if changed
+  if (nSel == pListView->nSel) {
+    return;
+  }
+  pListView->nSel = nSel;
+
+  // Scroll the selected row into view
+  if (nSel != XLISTVIEW_SEL_NONE) {
+    if ((uint16_t)nSel < pListView->nRowTop) {
+      gslc_ElemXListViewSetTop(pGui,pElemRef,nSel);
+    } else if ((pListView->nWndRows > 0) && ((uint16_t)nSel >= pListView->nRowTop + pListView->nWndRows)) {
+      gslc_ElemXListViewSetTop(pGui,pElemRef,nSel - pListView->nWndRows + 1);
+    }
+  }
+
+  // If any selection callback is defined, call it now
+  if (pListView->pfuncXSel != NULL) {
+    (*pListView->pfuncXSel)((void*)(pGui),(void*)(pElemRef),nSel);
+  }
+
+  // Mark for redraw
+  // - Only need incremental redraw
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+}
+
+int16_t gslc_ElemXListViewGetSel(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewGetSel";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return XLISTVIEW_SEL_NONE;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+  return pListView->nSel;
+}
+
+void gslc_ElemXListViewSetSelCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+  gslc_tsColor colSelFill,gslc_tsColor colSelText)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewSetSelCol";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+  pListView->colSelFill = colSelFill;
+  pListView->colSelText = colSelText;
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+
+void gslc_ElemXListViewSetSelFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_XLISTVIEW_SEL funcCb)
+{
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewSetSelFunc";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*        pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXListView*   pListView = (gslc_tsXListView*)(pElem->pXData);
+  pListView->pfuncXSel = funcCb;
+}
+
+
+// Draw a single row of the list view
+// - nWndRow is the row index within the window
+// - The row text is fetched from the data-source callback
+static void gslc_ElemXListViewDrawRow(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsElem* pElem,
+  gslc_tsXListView* pListView,uint8_t nWndRow)
+{
+  gslc_tsRect   rRow = gslc_ExpandRect(pElem->rElem,-1,-1);
+  uint16_t      nRow = pListView->nRowTop + nWndRow;
+  bool          bSel = (pListView->nSel != XLISTVIEW_SEL_NONE) && (nRow == (uint16_t)pListView->nSel);
+  gslc_tsColor  colBg  = (bSel)? pListView->colSelFill : GSLC_ELEM_COL_FILL(pGui,pElem);
+  gslc_tsColor  colTxt = (bSel)? pListView->colSelText : GSLC_ELEM_COL_TEXT(pGui,pElem);
+
+  rRow.y += nWndRow * pListView->nRowH;
+  rRow.h  = pListView->nRowH;
+  gslc_DrawFillRect(pGui,rRow,colBg);
+
+  // Rows beyond the end of the list are left empty
+  if ((nRow >= pListView->nRowCnt) || (pListView->pfuncXGetRow == NULL)) {
+    return;
+  }
+
+  // Fetch the row text from the data source
+  char  acRowStr[XLISTVIEW_STR_LEN];
+  acRowStr[0] = 0;
+  if (!(*pListView->pfuncXGetRow)((void*)(pGui),(void*)(pElemRef),nRow,acRowStr,XLISTVIEW_STR_LEN)) {
+    return;
+  }
+  acRowStr[XLISTVIEW_STR_LEN-1] = 0;
+
+  gslc_DrvDrawTxt(pGui,rRow.x + pListView->nMarginX + pListView->nTxtOffsetX,
+    rRow.y + pListView->nTxtOffsetY,GSLC_ELEM_TXT_FONT(pGui,pElem),acRowStr,pElem->eTxtFlags,colTxt,colBg);
+}
+
+// Redraw the list view
+// - A full redraw renders the frame and all visible rows
+// - An incremental redraw only renders the rows affected by
+//   changes in scroll position, selection or row count since
+//   the last redraw
+// - The Draw function parameters use void pointers to allow for
+//   simpler callback function definition & scalability.
+bool gslc_ElemXListViewDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
+{
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewDraw";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  // Typecast the parameters to match the GUI and element types
+  gslc_tsGui*       pGui  = (gslc_tsGui*)(pvGui);
+  gslc_tsElemRef*   pElemRef = (gslc_tsElemRef*)(pvElemRef);
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+
+  // Fetch the element's extended data structure
+  gslc_tsXListView* pListView;
+  pListView = (gslc_tsXListView*)(pElem->pXData);
+  if (pListView == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: ElemXListViewDraw(%s) pXData is NULL\n","");
+    return false;
+  }
+
+  bool          bFrameEn    = (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN);
+  gslc_tsRect   rInner      = gslc_ExpandRect(pElem->rElem,-1,-1);
+  uint8_t       nWndRows    = pListView->nWndRows;
+  uint8_t       nRowH       = pListView->nRowH;
+  uint16_t      nRowTop     = pListView->nRowTop;
+  int16_t       nSel        = pListView->nSel;
+  int16_t       nSelLast    = pListView->nSelLast;
+  uint16_t      nRowCnt     = pListView->nRowCnt;
+  uint16_t      nRowCntLast = pListView->nRowCntLast;
+  bool          bRedrawAll  = (eRedraw == GSLC_REDRAW_FULL) || (!pListView->bLastValid);
+  uint8_t       nExpStart   = 0;
+  uint8_t       nExpEnd     = 0;
+
+  // Draw the frame
+  if (eRedraw == GSLC_REDRAW_FULL) {
+    if (bFrameEn) {
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
+    }
+  }
+
+  // Scroll the rows that remain visible
+  // - The rows are moved with a display copy and only the
+  //   newly exposed rows are drawn
+  // - If the driver doesn't support copying display regions
+  //   or the scroll exceeds the window, then redraw all rows
+  if ((!bRedrawAll) && (nRowTop != pListView->nRowTopLast)) {
+    bool        bCopyOk = false;
+    uint16_t    nDelta;
+    gslc_tsRect rCopy;
+    if (nRowTop > pListView->nRowTopLast) {
+      nDelta = nRowTop - pListView->nRowTopLast;
+    } else {
+      nDelta = pListView->nRowTopLast - nRowTop;
+    }
+    if (nDelta < nWndRows) {
+      rCopy.x = rInner.x;
+      rCopy.w = rInner.w;
+      rCopy.h = (nWndRows - nDelta) * nRowH;
+      if (nRowTop > pListView->nRowTopLast) {
+        // Move the remaining rows up and expose rows at the bottom
+        rCopy.y   = rInner.y + nDelta * nRowH;
+        bCopyOk   = gslc_DrawCopyRect(pGui,rCopy,rCopy.x,rInner.y);
+        nExpStart = nWndRows - nDelta;
+        nExpEnd   = nWndRows;
+      } else {
+        // Move the remaining rows down and expose rows at the top
+        rCopy.y   = rInner.y;
+        bCopyOk   = gslc_DrawCopyRect(pGui,rCopy,rCopy.x,rInner.y + nDelta * nRowH);
+        nExpStart = 0;
+        nExpEnd   = nDelta;
+      }
+    }
+    if (!bCopyOk) {
+      bRedrawAll = true;
+    }
+  }
+
+  // Clear any region below the last full row
+  if (bRedrawAll) {
+    gslc_tsRect rRest = rInner;
+    rRest.y += nWndRows * nRowH;
+    if (rInner.h > nWndRows * nRowH) {
+      rRest.h = rInner.h - nWndRows * nRowH;
+      gslc_DrawFillRect(pGui,rRest,GSLC_ELEM_COL_FILL(pGui,pElem));
+    }
+  }
+
+  // Draw the rows that need updating
+  bool      bSelChg = (nSel != nSelLast);
+  bool      bCntChg = (nRowCnt != nRowCntLast);
+  uint16_t  nRowCntMin = (nRowCnt < nRowCntLast)? nRowCnt : nRowCntLast;
+  uint8_t   nWndRow;
+  int32_t   nRow;
+  bool      bRedrawRow;
+  for (nWndRow=0;nWndRow<nWndRows;nWndRow++) {
+    nRow = (int32_t)nRowTop + nWndRow;
+    bRedrawRow = bRedrawAll;
+    if ((nWndRow >= nExpStart) && (nWndRow < nExpEnd)) {
+      // Row was exposed by scrolling
+      bRedrawRow = true;
+    } else if ((bSelChg) && ((nRow == nSel) || (nRow == nSelLast))) {
+      // Row was selected or deselected
+      bRedrawRow = true;
+    } else if ((bCntChg) && (nRow >= nRowCntMin)) {
+      // Row was added or removed
+      bRedrawRow = true;
+    }
+    if (bRedrawRow) {
+      gslc_ElemXListViewDrawRow(pGui,pElemRef,pElem,pListView,nWndRow);
+    }
+  }
+
+  // Save the state for the next incremental redraw
+  pListView->bLastValid   = true;
+  pListView->nRowTopLast  = nRowTop;
+  pListView->nSelLast     = nSel;
+  pListView->nRowCntLast  = nRowCnt;
+
+  // Clear the redraw flag
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+
+  // Mark page as needing flip
+  gslc_PageFlipSet(pGui,true);
+
+  return true;
+}
+
+
+// This callback function is called by gslc_ElemSendEventTouch()
+// after any touch event
+bool gslc_ElemXListViewTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16_t nRelX,int16_t nRelY)
+{
+#if defined(DRV_TOUCH_NONE)
+  return false;
+#else
+
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXListViewTouch";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  gslc_tsGui*           pGui = NULL;
+  gslc_tsElemRef*       pElemRef = NULL;
+  gslc_tsElem*          pElem = NULL;
+  gslc_tsXListView*     pListView = NULL;
+
+  // Typecast the parameters to match the GUI
+  pGui      = (gslc_tsGui*)(pvGui);
+  pElemRef  = (gslc_tsElemRef*)(pvElemRef);
+  pElem     = gslc_GetElemFromRef(pGui,pElemRef);
+  pListView = (gslc_tsXListView*)(pElem->pXData);
+
+  int16_t   nWndRow;
+  int32_t   nRow;
+
+  (void)nRelX; // Unused
+
+  switch(eTouch) {
+
+    case GSLC_TOUCH_DOWN_IN:
+    case GSLC_TOUCH_MOVE_IN:
+      // Select the row under the touch
+      // - Account for the frame
+      if ((nRelY < 1) || (pListView->nRowH == 0)) {
+        break;
+      }
+      nWndRow = (nRelY - 1) / pListView->nRowH;
+      if (nWndRow >= pListView->nWndRows) {
+        break;
+      }
+      nRow = (int32_t)pListView->nRowTop + nWndRow;
+      if (nRow < pListView->nRowCnt) {
+        gslc_ElemXListViewSetSel(pGui,pElemRef,(int16_t)nRow);
+      }
+      break;
+
+    case GSLC_TOUCH_SET_REL:
+      // Overload the "nRelY" parameter to move the selection
+      if (pListView->nSel == XLISTVIEW_SEL_NONE) {
+        gslc_ElemXListViewSetSel(pGui,pElemRef,pListView->nRowTop);
+      } else {
+        nRow = (int32_t)pListView->nSel + nRelY;
+        nRow = (nRow < 0)? 0 : nRow;
+        nRow = (nRow > XLISTVIEW_ROW_MAX)? XLISTVIEW_ROW_MAX : nRow;
+        gslc_ElemXListViewSetSel(pGui,pElemRef,(int16_t)nRow);
+      }
+      break;
+
+    case GSLC_TOUCH_SET_ABS:
+      // Overload the "nRelY" parameter to select a row
+      gslc_ElemXListViewSetSel(pGui,pElemRef,nRelY);
+      break;
+
+    default:
+      return false;
+      break;
+  }
+
+  return true;
+  #endif // !DRV_TOUCH_NONE
+}
+
+// ============================================================================
@@ -0,0 +1,271 @@
+#ifndef _GUISLICE_EX_XLISTVIEW_H_
+#define _GUISLICE_EX_XLISTVIEW_H_
+
+#include "GUIslice.h"
+
+
+// =======================================================================
+// GUIslice library extension: List view control
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2019 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file XListView.h
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+
+// ============================================================================
+// Extended Element: ListView
+// - A scrolling list of selectable rows whose content is provided
+//   by a data-source callback. Only the visible rows are fetched
+//   and rendered, so the memory usage is independent of the
+//   number of rows in the list.
+// ============================================================================
+
+// Define unique identifier for extended element type
+// - Select any number above GSLC_TYPE_BASE_EXTEND
+#define  GSLC_TYPEX_LISTVIEW GSLC_TYPE_BASE_EXTEND + 6
+
+/// Maximum length of the text fetched for a row (including terminator)
+#define XLISTVIEW_STR_LEN   40
+
+/// Selection value indicating that no row is selected
+#define XLISTVIEW_SEL_NONE  -1
+
+/// Maximum number of rows
+/// - Limited so that any row can be selected by its (int16_t) index
+#define XLISTVIEW_ROW_MAX   32767
+
+/// Callback function for list view data source
+/// - Called to fetch the text of row nRow (0..nRowCnt-1) when it is drawn
+/// - The text (including terminator) must be written into pStrBuf,
+///   which has a capacity of nStrBufMax bytes
+/// - Return false if no text is available for the row
+typedef bool (*GSLC_CB_XLISTVIEW_GETROW)(void* pvGui,void* pvElemRef,uint16_t nRow,char* pStrBuf,uint8_t nStrBufMax);
+
+/// Callback function for list view selection change
+/// - nSel: Selected row or XLISTVIEW_SEL_NONE
+typedef bool (*GSLC_CB_XLISTVIEW_SEL)(void* pvGui,void* pvElemRef,int16_t nSel);
+
+// Extended element data structures
+// - These data structures are maintained in the gslc_tsElem
+//   structure via the pXData pointer
+
+/// Extended data for ListView element
+typedef struct {
+  // Config
+  uint16_t                  nRowCnt;      ///< Number of rows in the data source
+  uint8_t                   nRowH;        ///< Height of each row (pixels)
+  int8_t                    nMarginX;     ///< Margin for row text (X)
+  gslc_tsColor              colSelFill;   ///< Fill color of selected row
+  gslc_tsColor              colSelText;   ///< Text color of selected row
+
+  // Precalculated params
+  uint8_t                   nWndRows;     ///< Number of rows visible in the window
+  int8_t                    nTxtOffsetX;  ///< Text offset (X) to correct for font bounds
+  int8_t                    nTxtOffsetY;  ///< Text offset (Y) to correct for font bounds
+
+  // Current status
+  uint16_t                  nRowTop;      ///< Row shown at top of window
+  int16_t                   nSel;         ///< Selected row (or XLISTVIEW_SEL_NONE)
+
+  // Redraw
+  bool                      bLastValid;   ///< State from last redraw is valid?
+  uint16_t                  nRowTopLast;  ///< Row shown at top of window at last redraw
+  int16_t                   nSelLast;     ///< Selected row at last redraw
+  uint16_t                  nRowCntLast;  ///< Number of rows at last redraw
+
+  // Callbacks
+  GSLC_CB_XLISTVIEW_GETROW  pfuncXGetRow; ///< Callback func ptr for row text
+  GSLC_CB_XLISTVIEW_SEL     pfuncXSel;    ///< Callback func ptr for selection change
+} gslc_tsXListView;
+
+
+///
+/// Create a ListView Element
+/// - The row text is requested from the data-source callback only
+///   for rows that are visible when they need to be drawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
+/// \param[in]  nPage:       Page ID to attach element to
+/// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
+/// \param[in]  rElem:       Rectangle coordinates defining list view size
+/// \param[in]  nFontId:     Font ID to use for the row text
+/// \param[in]  nRowH:       Height of each row (pixels) or 0 to derive from font
+/// \param[in]  nRowCnt:     Number of rows in the data source
+///                          (limited to XLISTVIEW_ROW_MAX)
+/// \param[in]  pfuncGetRow: Data-source callback to fetch the text of a row
+///
+/// \return Pointer to Element reference or NULL if failure
+///
+gslc_tsElemRef* gslc_ElemXListViewCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
+  gslc_tsXListView* pXData,gslc_tsRect rElem,int16_t nFontId,uint8_t nRowH,
+  uint16_t nRowCnt,GSLC_CB_XLISTVIEW_GETROW pfuncGetRow);
+
+
+///
+/// Set the number of rows in a ListView's data source
+/// - Only visible rows affected by the change are redrawn
+/// - If the content of existing rows has changed, the element
+///   should be marked for full redraw
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nRowCnt:     Number of rows (limited to XLISTVIEW_ROW_MAX)
+///
+/// \return none
+///
+void gslc_ElemXListViewSetRowCnt(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nRowCnt);
+
+
+///
+/// Get the number of rows in a ListView's data source
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Number of rows
+///
+uint16_t gslc_ElemXListViewGetRowCnt(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+
+///
+/// Set the row shown at the top of a ListView's window
+/// - The rows remaining in view are scrolled by copying the display
+///   region (where supported by the driver) and only the newly
+///   exposed rows are drawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nRowTop:     Row to show at top of window
+///
+/// \return none
+///
+void gslc_ElemXListViewSetTop(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nRowTop);
+
+
+///
+/// Get the row shown at the top of a ListView's window
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Row at top of window
+///
+uint16_t gslc_ElemXListViewGetTop(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+
+///
+/// Set a ListView's selected row
+/// - The window is scrolled if needed to bring the selected row into view
+/// - Only the previously and newly selected rows are redrawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nSel:        Row to select (or XLISTVIEW_SEL_NONE)
+///
+/// \return none
+///
+void gslc_ElemXListViewSetSel(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nSel);
+
+
+///
+/// Get a ListView's selected row
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Selected row (or XLISTVIEW_SEL_NONE)
+///
+int16_t gslc_ElemXListViewGetSel(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+
+///
+/// Set the colors of a ListView's selected row
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  colSelFill:  Fill color of selected row
+/// \param[in]  colSelText:  Text color of selected row
+///
+/// \return none
+///
+void gslc_ElemXListViewSetSelCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,
+  gslc_tsColor colSelFill,gslc_tsColor colSelText);
+
+
+///
+/// Assign the selection callback function for a ListView
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  funcCb:      Function pointer to selection routine (or NULL for none)
+///
+/// \return none
+///
+void gslc_ElemXListViewSetSelFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_XLISTVIEW_SEL funcCb);
+
+
+///
+/// Draw a ListView element on the screen
+/// - Called from gslc_ElemDraw()
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvElemRef:   Void ptr to Element (typecast to gslc_tsElemRef*)
+/// \param[in]  eRedraw:     Redraw mode
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXListViewDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw);
+
+
+///
+/// Handle touch events to ListView element
+/// - Called from gslc_ElemSendEventTouch()
+/// - Touching a row selects it
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvElemRef:   Void ptr to Element ref (typecast to gslc_tsElemRef*)
+/// \param[in]  eTouch:      Touch event type
+/// \param[in]  nRelX:       Touch X coord relative to element
+/// \param[in]  nRelY:       Touch Y coord relative to element
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXListViewTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16_t nRelX,int16_t nRelY);
+
+// ============================================================================
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_EX_XLISTVIEW_H_
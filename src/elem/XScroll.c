@@ -0,0 +1,640 @@
+// =======================================================================
+// GUIslice library (extensions)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2019 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file XScroll.c
+
+
+
+// GUIslice library
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+#include "elem/XScroll.h"
+
+#include <stdio.h>
+
+#if (GSLC_USE_PROGMEM)
+    #include <avr/pgmspace.h>
+#endif
+
+// ----------------------------------------------------------------------------
+// Error Messages
+// ----------------------------------------------------------------------------
+
+extern const char GSLC_PMEM ERRSTR_NULL[];
+extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
+
+
+#if (GSLC_FEATURE_COMPOUND)
+// ============================================================================
+// Extended Element: Scroll container
+// - A compound element that shows a vertically-scrolled window
+//   onto a collection of sub-elements
+// - The sub-elements are moved with the content so that the normal
+//   touch tracking of the sub-element collection continues to work
+// - Scrolling moves the pixels that remain visible with a display
+//   copy (where supported by the driver) and only the newly
+//   exposed strip is drawn, with clipping to the strip enabled
+// - A drag is followed by a fling whose velocity is estimated from
+//   the most recent touch movement and decays on each tick by a
+//   fixed-point deceleration factor
+// ============================================================================
+
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XSCROLL_TYPE = {
+  GSLC_TYPEX_SCROLL,&gslc_ElemXScrollDraw,&gslc_ElemXScrollTouch,&gslc_ElemXScrollTick,NULL
+};
+
+// Create a scroll container element and add it to the GUI element list
+// - Defines default styling for the element
+// - Defines callback for redraw, touch and tick
+gslc_tsElemRef* gslc_ElemXScrollCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
+  gslc_tsXScroll* pXData,gslc_tsRect rElem,gslc_tsElem* asElem,uint16_t nMaxElem,
+  gslc_tsElemRef* asElemRef,uint16_t nMaxElemRef,int16_t nContentH)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXScroll*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXScroll));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
+  // Allocate the sub-element storage from the extended data arena
+  // if it wasn't provided
+  if ((asElem == NULL) && (nMaxElem > 0)) {
+    asElem = (gslc_tsElem*)gslc_XDataArenaAlloc(pGui,nPage,nMaxElem*sizeof(gslc_tsElem));
+    if (asElem == NULL) {
+      return NULL;
+    }
+  }
+  if (asElemRef == NULL) {
+    asElemRef = (gslc_tsElemRef*)gslc_XDataArenaAlloc(pGui,nPage,nMaxElemRef*sizeof(gslc_tsElemRef));
+    if (asElemRef == NULL) {
+      return NULL;
+    }
+  }
+  gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
+  gslc_tsElemRef* pElemRef = NULL;
+
+  sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_SCROLL,rElem,NULL,0,GSLC_FONT_NONE);
+  sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
+  sElem.nFeatures        |= GSLC_ELEM_FEA_FILL_EN;
+  sElem.nFeatures        |= GSLC_ELEM_FEA_CLICK_EN;
+  sElem.nFeatures        &= ~GSLC_ELEM_FEA_GLOW_EN;  // Don't need to glow outer element
+  sElem.nGroup            = GSLC_GROUP_ID_NONE;
+
+  // NOTE: We only use RAM for subelement storage
+  // - The sub-elements are repositioned as the content scrolls
+  gslc_CollectReset(&pXData->sCollect,asElem,nMaxElem,asElemRef,nMaxElemRef);
+
+  pXData->nContentH       = nContentH;
+  pXData->nScrollY        = 0;
+  pXData->nScrollFX       = 0;
+  pXData->nVelFX          = 0;
+  pXData->bTouchDown      = false;
+  pXData->bDrag           = false;
+  pXData->nTouchStartY    = 0;
+  pXData->nTouchLastY     = 0;
+  pXData->nTouchTickY     = 0;
+  pXData->nVelSampleCnt   = 0;
+  pXData->nVelSampleInd   = 0;
+  pXData->bLastValid      = false;
+  pXData->nScrollYLast    = 0;
+
+  sElem.pXData            = (void*)(pXData);
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XSCROLL_TYPE)) {
+    return NULL;
+  }
+
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
+
+  if (nPage != GSLC_PAGE_NONE) {
+    pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
+    return pElemRef;
+  } else {
+    GSLC_DEBUG_PRINT("ERROR: ElemXScrollCreate(%s) Compound elements inside compound elements not supported\n","");
+    return NULL;
+  }
+}
+
+
+// Determine the viewport region inside any frame
+static gslc_tsRect gslc_ElemXScrollGetView(gslc_tsElem* pElem)
+{
+  if (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) {
+    return gslc_ExpandRect(pElem->rElem,-1,-1);
+  }
+  return pElem->rElem;
+}
+
+// Determine whether two regions overlap
+static bool gslc_ElemXScrollOverlap(gslc_tsRect rA,gslc_tsRect rB)
+{
+  if ((rA.x >= rB.x + (int16_t)rB.w) || (rB.x >= rA.x + (int16_t)rA.w)) {
+    return false;
+  }
+  if ((rA.y >= rB.y + (int16_t)rB.h) || (rB.y >= rA.y + (int16_t)rA.h)) {
+    return false;
+  }
+  return true;
+}
+
+// Move the content to a new scroll offset
+// - The offset is limited to the range of the content
+// - The sub-elements are shifted so that their coordinates
+//   continue to match their position on the display
+// - Returns false if the requested offset was out of range
+static bool gslc_ElemXScrollTo(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nScrollY)
+{
+  gslc_tsElem*    pElem   = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXScroll* pScroll = (gslc_tsXScroll*)(pElem->pXData);
+  gslc_tsRect     rView   = gslc_ElemXScrollGetView(pElem);
+  gslc_tsCollect* pCollect = &pScroll->sCollect;
+  int16_t         nScrollMax = pScroll->nContentH - (int16_t)rView.h;
+  int16_t         nScrollReq = nScrollY;
+
+  if (nScrollY > nScrollMax) {
+    nScrollY = nScrollMax;
+  }
+  if (nScrollY < 0) {
+    nScrollY = 0;
+  }
+
+  int16_t nDelta = nScrollY - pScroll->nScrollY;
+  if (nDelta != 0) {
+    uint16_t        nInd;
+    gslc_tsElem*    pElemSub;
+    for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+      // NOTE: Only elements in RAM can be moved
+      if ((pCollect->asElemRef[nInd].eElemFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM) {
+        continue;
+      }
+      pElemSub = gslc_GetElemFromRef(pGui,&pCollect->asElemRef[nInd]);
+      pElemSub->rElem.y -= nDelta;
+    }
+    pScroll->nScrollY = nScrollY;
+
+    // Only need incremental redraw
+    // - The redraw determines which strip was exposed
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+  }
+
+  return (nScrollY == nScrollReq);
+}
+
+gslc_tsElemRef* gslc_ElemXScrollAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsElemRef* pElemRefSub)
+{
+  if ((pGui == NULL) || (pElemRef == NULL) || (pElemRefSub == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollAdd";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return NULL;
+  }
+  gslc_tsElem*    pElem   = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXScroll* pScroll = (gslc_tsXScroll*)(pElem->pXData);
+
+  // Position the sub-element relative to the current scroll offset
+  gslc_tsElem     sElemSub = *gslc_GetElemFromRef(pGui,pElemRefSub);
+  sElemSub.rElem.y -= pScroll->nScrollY;
+
+  gslc_tsElemRef* pElemRefAdd = gslc_CollectElemAdd(pGui,&pScroll->sCollect,&sElemSub,GSLC_ELEMREF_DEFAULT);
+  if (pElemRefAdd == NULL) {
+    return NULL;
+  }
+
+  // Propagate the parent relationship to enable a cascade
+  // of redrawing from the sub-element to the container
+  gslc_tsElem*    pElemAdd = gslc_GetElemFromRef(pGui,pElemRefAdd);
+  pElemAdd->pElemRefParent = pElemRef;
+
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+  return pElemRefAdd;
+}
+
+void gslc_ElemXScrollSetPos(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nScrollY)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollSetPos";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem*    pElem   = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXScroll* pScroll = (gslc_tsXScroll*)(pElem->pXData);
+
+  // Stop any fling in progress
+  pScroll->nVelFX = 0;
+  gslc_ElemXScrollTo(pGui,pElemRef,nScrollY);
+}
+
+int16_t gslc_ElemXScrollGetPos(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollGetPos";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return 0;
+  }
+  gslc_tsElem*    pElem   = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXScroll* pScroll = (gslc_tsXScroll*)(pElem->pXData);
+  return pScroll->nScrollY;
+}
+
+
+// Fully redraw a region of the viewport
+// - Drawing is clipped to the region so that sub-elements which
+//   straddle its edges don't disturb the surrounding pixels
+// - Any enclosing clip region is honored and restored afterwards
+static void gslc_ElemXScrollDrawRegion(gslc_tsGui* pGui,gslc_tsElem* pElem,
+  gslc_tsXScroll* pScroll,gslc_tsRect rRegion)
+{
+  gslc_tsCollect* pCollect = &pScroll->sCollect;
+  gslc_tsElemRef* pElemRefSub;
+  gslc_tsElem*    pElemSub;
+  uint16_t        nInd;
+  gslc_tsRect     rClipPrev;
+  bool            bClipPrev = gslc_GetClipRect(pGui,&rClipPrev);
+
+  if (!gslc_ClipRect(&rClipPrev,&rRegion)) {
+    // Region lies entirely outside the enclosing clip region
+    return;
+  }
+  gslc_SetClipRect(pGui,&rRegion);
+  gslc_DrawFillRect(pGui,rRegion,GSLC_ELEM_COL_FILL(pGui,pElem));
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElemRefSub = &(pCollect->asElemRef[nInd]);
+    if (pElemRefSub->eElemFlags == GSLC_ELEMREF_NONE) {
+      continue;
+    }
+    pElemSub    = gslc_GetElemFromRef(pGui,pElemRefSub);
+    if (gslc_ElemXScrollOverlap(pElemSub->rElem,rRegion)) {
+      gslc_ElemDrawByRef(pGui,pElemRefSub,GSLC_REDRAW_FULL);
+    }
+  }
+  gslc_SetClipRect(pGui,(bClipPrev)? &rClipPrev : NULL);
+}
+
+// Redraw the scroll container
+// - A full redraw renders the frame and the visible content
+// - An incremental redraw moves the retained content by the scroll
+//   distance since the last redraw, draws only the newly exposed
+//   strip and then any visible sub-elements marked for redraw
+// - The Draw function parameters use void pointers to allow for
+//   simpler callback function definition & scalability.
+bool gslc_ElemXScrollDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
+{
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollDraw";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  // Typecast the parameters to match the GUI and element types
+  gslc_tsGui*       pGui  = (gslc_tsGui*)(pvGui);
+  gslc_tsElemRef*   pElemRef = (gslc_tsElemRef*)(pvElemRef);
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+
+  // Fetch the element's extended data structure
+  gslc_tsXScroll*   pScroll;
+  pScroll = (gslc_tsXScroll*)(pElem->pXData);
+  if (pScroll == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: ElemXScrollDraw(%s) pXData is NULL\n","");
+    return false;
+  }
+
+  gslc_tsCollect*   pCollect    = &pScroll->sCollect;
+  gslc_tsRect       rView       = gslc_ElemXScrollGetView(pElem);
+  bool              bRedrawAll  = (eRedraw == GSLC_REDRAW_FULL) || (!pScroll->bLastValid);
+  bool              bExposed    = false;
+  gslc_tsRect       rExposed    = rView;
+  int16_t           nDelta      = pScroll->nScrollY - pScroll->nScrollYLast;
+
+  // Draw the frame
+  if (eRedraw == GSLC_REDRAW_FULL) {
+    if (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) {
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
+    }
+  }
+
+  // Scroll the content that remains visible
+  // - If the driver doesn't support copying display regions
+  //   or the scroll exceeds the viewport, then redraw all content
+  if ((!bRedrawAll) && (nDelta != 0)) {
+    bool        bCopyOk = false;
+    uint16_t    nDeltaAbs = (nDelta > 0)? nDelta : -nDelta;
+    gslc_tsRect rCopy = rView;
+    if (nDeltaAbs < rView.h) {
+      rCopy.h = rView.h - nDeltaAbs;
+      if (nDelta > 0) {
+        // Move the content up and expose a strip at the bottom
+        rCopy.y     = rView.y + nDeltaAbs;
+        bCopyOk     = gslc_DrawCopyRect(pGui,rCopy,rCopy.x,rView.y);
+        rExposed.y  = rView.y + rCopy.h;
+      } else {
+        // Move the content down and expose a strip at the top
+        bCopyOk     = gslc_DrawCopyRect(pGui,rCopy,rCopy.x,rView.y + nDeltaAbs);
+      }
+      rExposed.h  = nDeltaAbs;
+    }
+    if (bCopyOk) {
+      bExposed = true;
+    } else {
+      bRedrawAll = true;
+    }
+  }
+
+  if (bRedrawAll) {
+    gslc_ElemXScrollDrawRegion(pGui,pElem,pScroll,rView);
+  } else {
+    // Redraw any visible sub-elements marked for redraw
+    // - This is done before drawing the exposed strip so that any
+    //   sub-element straddling the strip is left fully up to date
+    gslc_tsElemRef* pElemRefSub;
+    gslc_tsElem*    pElemSub;
+    uint16_t        nInd;
+    gslc_tsRect     rClipPrev;
+    gslc_tsRect     rClipView = rView;
+    bool            bClipPrev = gslc_GetClipRect(pGui,&rClipPrev);
+    if (gslc_ClipRect(&rClipPrev,&rClipView)) {
+      gslc_SetClipRect(pGui,&rClipView);
+      for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+        pElemRefSub = &(pCollect->asElemRef[nInd]);
+        if (pElemRefSub->eElemFlags == GSLC_ELEMREF_NONE) {
+          continue;
+        }
+        pElemSub    = gslc_GetElemFromRef(pGui,pElemRefSub);
+        if (gslc_ElemXScrollOverlap(pElemSub->rElem,rView)) {
+          gslc_ElemDrawByRef(pGui,pElemRefSub,gslc_ElemGetRedraw(pGui,pElemRefSub));
+        }
+      }
+      gslc_SetClipRect(pGui,(bClipPrev)? &rClipPrev : NULL);
+    }
+
+    if (bExposed) {
+      gslc_ElemXScrollDrawRegion(pGui,pElem,pScroll,rExposed);
+    }
+  }
+
+  // Save the state for the next incremental redraw
+  pScroll->bLastValid   = true;
+  pScroll->nScrollYLast = pScroll->nScrollY;
+
+  // Clear the redraw flag
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+
+  // Mark page as needing flip
+  gslc_PageFlipSet(pGui,true);
+
+  return true;
+}
+
+
+// Record the touch movement since the last sample
+static void gslc_ElemXScrollVelSample(gslc_tsXScroll* pScroll)
+{
+  pScroll->anVelSample[pScroll->nVelSampleInd] = pScroll->nTouchLastY - pScroll->nTouchTickY;
+  pScroll->nVelSampleInd = (pScroll->nVelSampleInd + 1) % XSCROLL_VEL_SAMPLES;
+  if (pScroll->nVelSampleCnt < XSCROLL_VEL_SAMPLES) {
+    pScroll->nVelSampleCnt++;
+  }
+  pScroll->nTouchTickY = pScroll->nTouchLastY;
+}
+
+// This callback function is called by gslc_ElemSendEventTouch()
+// after any touch event
+// - Touches are passed to the sub-elements until the touch has moved
+//   beyond XSCROLL_DRAG_THRESH, at which point any sub-element
+//   tracking is cancelled and the content follows the touch
+// - Touching the content while it is flinging stops the fling
+bool gslc_ElemXScrollTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16_t nRelX,int16_t nRelY)
+{
+#if defined(DRV_TOUCH_NONE)
+  return false;
+#else
+
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollTouch";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  gslc_tsGui*           pGui = NULL;
+  gslc_tsElemRef*       pElemRef = NULL;
+  gslc_tsElem*          pElem = NULL;
+  gslc_tsXScroll*       pScroll = NULL;
+
+  // Typecast the parameters to match the GUI
+  pGui      = (gslc_tsGui*)(pvGui);
+  pElemRef  = (gslc_tsElemRef*)(pvElemRef);
+  pElem     = gslc_GetElemFromRef(pGui,pElemRef);
+  pScroll   = (gslc_tsXScroll*)(pElem->pXData);
+
+  gslc_tsCollect*   pCollect = &pScroll->sCollect;
+  gslc_tsElemRef*   pElemRefTracked = NULL;
+  int16_t           nX = pElem->rElem.x + nRelX;
+  int16_t           nY = pElem->rElem.y + nRelY;
+  int16_t           nMove;
+  int32_t           nSum;
+  uint8_t           nInd;
+  bool              bSubTouch = false;
+
+  // Reset the in/out status of the touch event since the
+  // sub-element collection determines its own in/out status
+  switch (eTouch) {
+    case GSLC_TOUCH_DOWN_IN:
+    case GSLC_TOUCH_DOWN_OUT:
+      pScroll->bTouchDown     = true;
+      pScroll->nTouchStartY   = nY;
+      pScroll->nTouchLastY    = nY;
+      pScroll->nTouchTickY    = nY;
+      pScroll->nVelSampleCnt  = 0;
+      pScroll->nVelSampleInd  = 0;
+      if (pScroll->nVelFX != 0) {
+        // Catch the content while it is flinging
+        // - The touch only stops the fling and is not
+        //   passed on to the sub-elements
+        pScroll->nVelFX = 0;
+        pScroll->bDrag  = true;
+      } else {
+        pScroll->bDrag  = false;
+        eTouch    = GSLC_TOUCH_DOWN;
+        bSubTouch = true;
+      }
+      break;
+
+    case GSLC_TOUCH_MOVE_IN:
+    case GSLC_TOUCH_MOVE_OUT:
+      if (!pScroll->bTouchDown) {
+        break;
+      }
+      if (!pScroll->bDrag) {
+        nMove = nY - pScroll->nTouchStartY;
+        if ((nMove < XSCROLL_DRAG_THRESH) && (nMove > -XSCROLL_DRAG_THRESH)) {
+          eTouch    = GSLC_TOUCH_MOVE;
+          bSubTouch = true;
+          break;
+        }
+        // Start dragging the content
+        // - Cancel the touch tracking of any sub-element
+        pScroll->bDrag = true;
+        pElemRefTracked = gslc_CollectGetElemRefTracked(pGui,pCollect);
+        if (pElemRefTracked != NULL) {
+          gslc_ElemSendEventTouch(pGui,pElemRefTracked,GSLC_TOUCH_UP_OUT,nX,nY);
+          gslc_ElemSetGlow(pGui,pElemRefTracked,false);
+          gslc_CollectSetElemTracked(pGui,pCollect,NULL);
+        }
+      }
+      // Content follows the touch
+      gslc_ElemXScrollTo(pGui,pElemRef,pScroll->nScrollY - (nY - pScroll->nTouchLastY));
+      pScroll->nTouchLastY = nY;
+      break;
+
+    case GSLC_TOUCH_UP_IN:
+    case GSLC_TOUCH_UP_OUT:
+      if (!pScroll->bTouchDown) {
+        break;
+      }
+      pScroll->bTouchDown = false;
+      if (!pScroll->bDrag) {
+        eTouch    = GSLC_TOUCH_UP;
+        bSubTouch = true;
+        break;
+      }
+      pScroll->bDrag = false;
+
+      // Include any movement since the last tick
+      if (pScroll->nTouchLastY != pScroll->nTouchTickY) {
+        gslc_ElemXScrollVelSample(pScroll);
+      }
+
+      // Start the fling with the average recent touch velocity
+      // - The content scrolls in the opposite direction to the touch
+      if (pScroll->nVelSampleCnt > 0) {
+        nSum = 0;
+        for (nInd=0;nInd<pScroll->nVelSampleCnt;nInd++) {
+          nSum += pScroll->anVelSample[nInd];
+        }
+        pScroll->nVelFX = -(nSum * (1<<XSCROLL_FX_SHIFT)) / pScroll->nVelSampleCnt;
+        if ((pScroll->nVelFX < XSCROLL_VEL_MIN_FX) && (pScroll->nVelFX > -XSCROLL_VEL_MIN_FX)) {
+          pScroll->nVelFX = 0;
+        }
+        pScroll->nScrollFX = (int32_t)pScroll->nScrollY * (1<<XSCROLL_FX_SHIFT);
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  // Cascade the touch event to the sub-element collection
+  // - Note that we use absolute coordinates
+  if (bSubTouch) {
+    gslc_tsEventTouch sEventTouch;
+    sEventTouch.nX      = nX;
+    sEventTouch.nY      = nY;
+    sEventTouch.eTouch  = eTouch;
+    gslc_CollectTouch(pGui,pCollect,&sEventTouch);
+
+    // Mark container as needing redraw if any
+    // sub-element needs redraw
+    // - Only the dirty sub-elements need to be redrawn
+    if (gslc_CollectGetRedraw(pGui,pCollect)) {
+      gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
+    }
+  }
+
+  return true;
+  #endif // !DRV_TOUCH_NONE
+}
+
+// This callback function is called by gslc_ElemEvent()
+// on every GUI tick
+// - Samples the touch movement during a drag
+// - Advances and decelerates any fling in progress
+bool gslc_ElemXScrollTick(void* pvGui,void* pvElemRef)
+{
+  if ((pvGui == NULL) || (pvElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXScrollTick";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  gslc_tsGui*       pGui      = (gslc_tsGui*)(pvGui);
+  gslc_tsElemRef*   pElemRef  = (gslc_tsElemRef*)(pvElemRef);
+  gslc_tsElem*      pElem     = gslc_GetElemFromRef(pGui,pElemRef);
+  gslc_tsXScroll*   pScroll   = (gslc_tsXScroll*)(pElem->pXData);
+
+  // Propagate the tick to the sub-elements
+  gslc_tsEvent  sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)(&pScroll->sCollect),NULL);
+  gslc_CollectEvent(pGui,sEvent);
+
+  if (pScroll->bTouchDown) {
+    // Sample the touch movement over the last tick
+    // - A touch that is held still contributes zero velocity
+    if (pScroll->bDrag) {
+      gslc_ElemXScrollVelSample(pScroll);
+    }
+    return true;
+  }
+
+  if (pScroll->nVelFX == 0) {
+    return true;
+  }
+
+  // Advance the fling
+  // - The position is tracked in fixed-point so that slow
+  //   speeds continue to move by fractional pixels
+  // - The fling stops at either end of the content
+  pScroll->nScrollFX += pScroll->nVelFX;
+  if (!gslc_ElemXScrollTo(pGui,pElemRef,(int16_t)(pScroll->nScrollFX / (1<<XSCROLL_FX_SHIFT)))) {
+    pScroll->nVelFX = 0;
+    return true;
+  }
+
+  // Decelerate
+  pScroll->nVelFX = (pScroll->nVelFX * XSCROLL_DECEL_FX) / 256;
+  if ((pScroll->nVelFX < XSCROLL_VEL_MIN_FX) && (pScroll->nVelFX > -XSCROLL_VEL_MIN_FX)) {
+    pScroll->nVelFX = 0;
+  }
+
+  return true;
+}
+
+#endif // GSLC_FEATURE_COMPOUND
+
+// ============================================================================
@@ -0,0 +1,218 @@
+#ifndef _GUISLICE_EX_XSCROLL_H_
+#define _GUISLICE_EX_XSCROLL_H_
+
+#include "GUIslice.h"
+
+
+// =======================================================================
+// GUIslice library extension: Scroll container
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2019 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file XScroll.h
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+
+#if (GSLC_FEATURE_COMPOUND)
+// ============================================================================
+// Extended Element: Scroll container
+// - A compound element that shows a window (viewport) onto a
+//   collection of sub-elements that is taller than the viewport
+// - The content can be dragged by touch and continues to scroll
+//   (fling) after release, decelerating until it comes to rest
+// - Scrolling moves the pixels that remain visible with a display
+//   copy (where supported by the driver) and only the newly
+//   exposed strip is drawn
+// ============================================================================
+
+// Define unique identifier for extended element type
+// - Select any number above GSLC_TYPE_BASE_EXTEND
+#define  GSLC_TYPEX_SCROLL GSLC_TYPE_BASE_EXTEND + 7
+
+/// Touch movement (pixels) before a press turns into a drag
+#define XSCROLL_DRAG_THRESH   6
+
+/// Number of recent touch movement samples (one per tick) used to estimate fling velocity
+#define XSCROLL_VEL_SAMPLES   4
+
+/// Number of fractional bits in the fixed-point fling velocity
+#define XSCROLL_FX_SHIFT      8
+
+/// Fling deceleration: velocity is scaled by (XSCROLL_DECEL_FX / 256) per tick
+#define XSCROLL_DECEL_FX      235
+
+/// Fling stops once its speed falls below this (fixed-point pixels / tick)
+#define XSCROLL_VEL_MIN_FX    (1<<(XSCROLL_FX_SHIFT-1))
+
+// Extended element data structures
+// - These data structures are maintained in the gslc_tsElem
+//   structure via the pXData pointer
+
+/// Extended data for Scroll container element
+typedef struct {
+  // Content
+  gslc_tsCollect      sCollect;       ///< Collection management for sub-elements
+  int16_t             nContentH;      ///< Height of the scrolled content (pixels)
+
+  // Current status
+  int16_t             nScrollY;       ///< Scroll offset of the content (pixels)
+  int32_t             nScrollFX;      ///< Scroll offset during fling (fixed-point)
+  int32_t             nVelFX;         ///< Fling velocity (fixed-point pixels / tick)
+
+  // Touch tracking
+  bool                bTouchDown;     ///< Touch is currently pressed
+  bool                bDrag;          ///< Touch has turned into a drag
+  int16_t             nTouchStartY;   ///< Touch Y coord at touch down
+  int16_t             nTouchLastY;    ///< Touch Y coord at last touch event
+  int16_t             nTouchTickY;    ///< Touch Y coord at last velocity sample
+  int16_t             anVelSample[XSCROLL_VEL_SAMPLES]; ///< Recent touch movement per tick (pixels)
+  uint8_t             nVelSampleCnt;  ///< Number of valid move samples
+  uint8_t             nVelSampleInd;  ///< Next move sample slot
+
+  // Redraw
+  bool                bLastValid;     ///< State from last redraw is valid?
+  int16_t             nScrollYLast;   ///< Scroll offset at last redraw
+} gslc_tsXScroll;
+
+
+///
+/// Create a Scroll container Element
+/// - The storage for the sub-elements is provided by the caller or
+///   allocated from the extended data arena (see gslc_SetXDataArena)
+/// - Sub-elements are attached with gslc_ElemXScrollAdd()
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
+/// \param[in]  nPage:       Page ID to attach element to
+/// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
+/// \param[in]  rElem:       Rectangle coordinates defining the viewport
+/// \param[in]  asElem:      Storage for the sub-elements (or NULL to allocate)
+/// \param[in]  nMaxElem:    Maximum number of sub-elements
+/// \param[in]  asElemRef:   Storage for the sub-element references (or NULL to allocate)
+/// \param[in]  nMaxElemRef: Maximum number of sub-element references
+/// \param[in]  nContentH:   Height of the scrolled content (pixels)
+///
+/// \return Pointer to Element reference or NULL if failure
+///
+gslc_tsElemRef* gslc_ElemXScrollCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
+  gslc_tsXScroll* pXData,gslc_tsRect rElem,gslc_tsElem* asElem,uint16_t nMaxElem,
+  gslc_tsElemRef* asElemRef,uint16_t nMaxElemRef,int16_t nContentH);
+
+
+///
+/// Add a sub-element to a Scroll container
+/// - The sub-element must have been created with GSLC_PAGE_NONE
+/// - The sub-element coordinates are those it would have with the
+///   content scrolled to the top
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pElemRefSub: Pointer to the temporary sub-element reference
+///
+/// \return Pointer to the sub-element reference or NULL if failure
+///
+gslc_tsElemRef* gslc_ElemXScrollAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsElemRef* pElemRefSub);
+
+
+///
+/// Set the scroll offset of a Scroll container
+/// - Any fling in progress is stopped
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nScrollY:    Scroll offset of the content (pixels)
+///
+/// \return none
+///
+void gslc_ElemXScrollSetPos(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nScrollY);
+
+
+///
+/// Get the scroll offset of a Scroll container
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return Scroll offset of the content (pixels)
+///
+int16_t gslc_ElemXScrollGetPos(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+
+///
+/// Draw a Scroll container element on the screen
+/// - Called from gslc_ElemDraw()
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvElemRef:   Void ptr to Element (typecast to gslc_tsElemRef*)
+/// \param[in]  eRedraw:     Redraw mode
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXScrollDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw);
+
+
+///
+/// Handle touch events to Scroll container element
+/// - Called from gslc_ElemSendEventTouch()
+/// - Touches are passed to the sub-elements until the touch
+///   moves far enough to start a drag
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvElemRef:   Void ptr to Element ref (typecast to gslc_tsElemRef*)
+/// \param[in]  eTouch:      Touch event type
+/// \param[in]  nRelX:       Touch X coord relative to element
+/// \param[in]  nRelY:       Touch Y coord relative to element
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXScrollTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16_t nRelX,int16_t nRelY);
+
+
+///
+/// Handle tick events to Scroll container element
+/// - Advances any fling in progress
+///
+/// \param[in]  pvGui:       Void ptr to GUI (typecast to gslc_tsGui*)
+/// \param[in]  pvElemRef:   Void ptr to Element ref (typecast to gslc_tsElemRef*)
+///
+/// \return true if success, false otherwise
+///
+bool gslc_ElemXScrollTick(void* pvGui,void* pvElemRef);
+
+#endif // GSLC_FEATURE_COMPOUND
+
+// ============================================================================
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_EX_XSCROLL_H_
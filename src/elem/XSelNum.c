@@ -85,18 +85,33 @@ static const int16_t  SELNUM_ID_BTN_INC = 100;
 static const int16_t  SELNUM_ID_BTN_DEC = 101;
 static const int16_t  SELNUM_ID_TXT     = 102;
 
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XSELNUM_TYPE = {
+  GSLC_TYPEX_SELNUM,&gslc_ElemXSelNumDraw,&gslc_ElemXSelNumTouch,NULL,NULL
+};
+
 // Create a compound element
 // - For now just two buttons and a text area
 gslc_tsElemRef* gslc_ElemXSelNumCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
   gslc_tsXSelNum* pXData,gslc_tsRect rElem,int8_t nFontId)
 {
 
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXSelNumCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXSelNum*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXSelNum));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXSelNumCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
   gslc_tsElem sElem;
+  gslc_tsStyle  sStyle;
 
 
   // Initialize composite element
@@ -122,15 +137,17 @@ gslc_tsElemRef* gslc_ElemXSelNumCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
 
 
   sElem.pXData            = (void*)(pXData);
-  // Specify the custom drawing callback
-  sElem.pfuncXDraw        = &gslc_ElemXSelNumDraw;
-  // Specify the custom touch tracking callback
-  sElem.pfuncXTouch       = &gslc_ElemXSelNumTouch;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XSELNUM_TYPE)) {
+    return NULL;
+  }
 
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
 
 
   // Now create the sub elements
@@ -219,8 +236,10 @@ gslc_tsElemRef* gslc_ElemXSelNumCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
 
 
 // Redraw the compound element
-// - When drawing a compound element, we clear the background
+// - When fully redrawing a compound element, we clear the background
 //   and then redraw the sub-element collection.
+// - An incremental redraw only redraws the sub-elements that
+//   have been marked as needing redraw
 bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 {
   if ((pvGui == NULL) || (pvElemRef == NULL)) {
@@ -246,22 +265,27 @@ bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the compound element fill (background)
   // - Should only need to do this in full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_COL_FILL_GLOW(pGui,pElem):GSLC_ELEM_COL_FILL(pGui,pElem));
   }
 
   // Draw the sub-elements
-  // - For now, force redraw of entire compound element
+  // - A full redraw forces redraw of the entire compound element
+  // - Otherwise only the dirty sub-elements are redrawn
   gslc_tsCollect* pCollect = &pSelNum->sCollect;
+  uint32_t        nSubType = (eRedraw == GSLC_REDRAW_FULL)? GSLC_EVTSUB_DRAW_FORCE : GSLC_EVTSUB_DRAW_NEEDED;
 
-  gslc_tsEvent  sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,GSLC_EVTSUB_DRAW_FORCE,(void*)(pCollect),NULL);
+  gslc_tsEvent  sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,(void*)(pCollect),NULL);
   gslc_CollectEvent(pGui,sEvent);
 
   // Optionally, draw a frame around the compound element
   // - This could instead be done by creating a sub-element
   //   of type box.
   // - We don't need to show any glowing of the compound element
-
-  gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFrameGlow:pElem->colElemFrame);
+  // - The frame is not affected by the sub-elements so it
+  //   only needs to be drawn during a full redraw
+  if (eRedraw == GSLC_REDRAW_FULL) {
+    gslc_DrawFrameRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem):GSLC_ELEM_COL_FRAME(pGui,pElem));
+  }
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
@@ -403,17 +427,22 @@ bool gslc_ElemXSelNumTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
 
 
   // Handle any compound element operations
-  switch(eTouch) {
-    case GSLC_TOUCH_DOWN_IN:
-    case GSLC_TOUCH_MOVE_IN:
-      gslc_ElemSetGlow(pGui,pElemRef,true);
-      break;
-    case GSLC_TOUCH_MOVE_OUT:
-    case GSLC_TOUCH_UP_IN:
-    case GSLC_TOUCH_UP_OUT:
-    default:
-      gslc_ElemSetGlow(pGui,pElemRef,false);
-      break;
+  // - Glowing of the compound element is normally disabled, in which
+  //   case we skip the glow update to avoid a full redraw of
+  //   the compound element with every touch
+  if (pElem->nFeatures & GSLC_ELEM_FEA_GLOW_EN) {
+    switch(eTouch) {
+      case GSLC_TOUCH_DOWN_IN:
+      case GSLC_TOUCH_MOVE_IN:
+        gslc_ElemSetGlow(pGui,pElemRef,true);
+        break;
+      case GSLC_TOUCH_MOVE_OUT:
+      case GSLC_TOUCH_UP_IN:
+      case GSLC_TOUCH_UP_OUT:
+      default:
+        gslc_ElemSetGlow(pGui,pElemRef,false);
+        break;
+    }
   }
 
   // Handle any sub-element operations
@@ -456,8 +485,9 @@ bool gslc_ElemXSelNumTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
 
   // Mark compound element as needing redraw if any
   // sub-element needs redraw
+  // - Only the dirty sub-elements need to be redrawn
   if (gslc_CollectGetRedraw(pGui,pCollect)) {
-    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 
   return true;
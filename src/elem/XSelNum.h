@@ -88,6 +88,7 @@ typedef struct {
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining element size
 /// \param[in]  nFontId:     Font ID to use for drawing the element
 ///
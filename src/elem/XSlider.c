@@ -77,6 +77,11 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 // - A linear slider control
 // ============================================================================
 
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XSLIDER_TYPE = {
+  GSLC_TYPEX_SLIDER,&gslc_ElemXSliderDraw,&gslc_ElemXSliderTouch,NULL,NULL
+};
+
 // Create a slider element and add it to the GUI element list
 // - Defines default styling for the element
 // - Defines callback for redraw and touch
@@ -84,12 +89,22 @@ gslc_tsElemRef* gslc_ElemXSliderCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   gslc_tsXSlider* pXData,gslc_tsRect rElem,int16_t nPosMin,int16_t nPosMax,int16_t nPos,
   uint16_t nThumbSz,bool bVert)
 {
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXSliderCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXSlider*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXSlider));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXSliderCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
   gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_SLIDER,rElem,NULL,0,GSLC_FONT_NONE);
   sElem.nFeatures        &= ~GSLC_ELEM_FEA_FRAME_EN;
@@ -107,16 +122,19 @@ gslc_tsElemRef* gslc_ElemXSliderCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->colTrim         = GSLC_COL_BLACK;
   pXData->nTickDiv        = 0;
   pXData->pfuncXPos       = NULL;
+  pXData->bThumbLastValid = false;
   sElem.pXData            = (void*)(pXData);
-  // Specify the custom drawing callback
-  sElem.pfuncXDraw        = &gslc_ElemXSliderDraw;
-  // Specify the custom touch tracking callback
-  sElem.pfuncXTouch       = &gslc_ElemXSliderTouch;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XSLIDER_TYPE)) {
+    return NULL;
+  }
 
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
 
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
@@ -216,7 +234,8 @@ void gslc_ElemXSliderSetPosFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_C
 
 
 // Redraw the slider
-// - Note that this redraw is for the entire element rect region
+// - A full redraw covers the entire element rect region
+// - An incremental redraw only covers the previous and new thumb regions
 // - The Draw function parameters use void pointers to allow for
 //   simpler callback function definition & scalability.
 bool gslc_ElemXSliderDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
@@ -274,54 +293,6 @@ bool gslc_ElemXSliderDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   }
   int16_t nCtrlPos  = (nPosOffset*nCtrlRng/nPosRng)+nMargin;
 
-
-  // Draw the background
-  // - TODO: To reduce flicker on unbuffered displays, one could consider
-  //         redrawing only the thumb (last drawn position) with fill and
-  //         then redraw other portions. This would prevent the
-  //         track / ticks from flickering needlessly. A full redraw would
-  //         be required if it was first draw action.
-  gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
-
-  // Draw any ticks
-  // - Need at least one tick segment
-  if (nTickDiv>=1) {
-    uint16_t  nTickInd;
-    int16_t   nTickOffset;
-    for (nTickInd=0;nTickInd<=nTickDiv;nTickInd++) {
-      nTickOffset = nTickInd * nCtrlRng / nTickDiv;
-      if (!bVert) {
-        gslc_DrawLine(pGui,nX0+nMargin+ nTickOffset,nYMid,
-                nX0+nMargin + nTickOffset,nYMid+nTickLen,colTick);
-      } else {
-        gslc_DrawLine(pGui,nXMid,nY0+nMargin+ nTickOffset,
-                nXMid+nTickLen,nY0+nMargin + nTickOffset,colTick);
-      }
-    }
-  }
-
-
-  // Draw the track
-  if (!bVert) {
-    // Make the track highlight during glow
-    gslc_DrawLine(pGui,nX0+nMargin,nYMid,nX1-nMargin,nYMid,
-            bGlow? pElem->colElemFrameGlow : pElem->colElemFrame);
-    // Optionally draw a trim line
-    if (bTrim) {
-      gslc_DrawLine(pGui,nX0+nMargin,nYMid+1,nX1-nMargin,nYMid+1,colTrim);
-    }
-
-  } else {
-    // Make the track highlight during glow
-    gslc_DrawLine(pGui,nXMid,nY0+nMargin,nXMid,nY1-nMargin,
-            bGlow? pElem->colElemFrameGlow : pElem->colElemFrame);
-    // Optionally draw a trim line
-    if (bTrim) {
-      gslc_DrawLine(pGui,nXMid+1,nY0+nMargin,nXMid+1,nY1-nMargin,colTrim);
-    }
-  }
-
-
   int16_t       nCtrlX0,nCtrlY0;
   gslc_tsRect   rThumb;
   if (!bVert) {
@@ -336,15 +307,113 @@ bool gslc_ElemXSliderDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   rThumb.w  = 2*nThumbSz;
   rThumb.h  = 2*nThumbSz;
 
+  // Determine the region to redraw
+  // - On an incremental redraw (eg. during drag) only the region
+  //   occupied by the thumb at the last redraw is erased, and
+  //   only the portions of the ticks & track within it are restored
+  // - A full redraw is required if the thumb hasn't been drawn yet
+  bool          bRedrawInc = (eRedraw == GSLC_REDRAW_INC) && (pSlider->bThumbLastValid);
+  bool          bRedrawBack = true;
+  gslc_tsRect   rClip = pSlider->rThumbLast;
+  rClip.x += nX0;
+  rClip.y += nY0;
+  if (bRedrawInc) {
+    if ((rClip.x == rThumb.x) && (rClip.y == rThumb.y) &&
+        (rClip.w == rThumb.w) && (rClip.h == rThumb.h)) {
+      // Thumb hasn't moved, so it will simply be drawn over itself
+      bRedrawBack = false;
+    }
+  }
+
+  int16_t   nLineX0,nLineY0,nLineX1,nLineY1;
+
+  if (bRedrawBack) {
+
+    // Draw the background
+    if (!bRedrawInc) {
+      gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?GSLC_ELEM_COL_FILL_GLOW(pGui,pElem):GSLC_ELEM_COL_FILL(pGui,pElem));
+    } else {
+      gslc_DrawFillRect(pGui,rClip,(bGlow)?GSLC_ELEM_COL_FILL_GLOW(pGui,pElem):GSLC_ELEM_COL_FILL(pGui,pElem));
+    }
+
+    // Draw any ticks
+    // - Need at least one tick segment
+    if (nTickDiv>=1) {
+      uint16_t  nTickInd;
+      int16_t   nTickOffset;
+      for (nTickInd=0;nTickInd<=nTickDiv;nTickInd++) {
+        nTickOffset = nTickInd * nCtrlRng / nTickDiv;
+        if (!bVert) {
+          nLineX0 = nX0+nMargin+nTickOffset;
+          nLineY0 = nYMid;
+          nLineX1 = nX0+nMargin+nTickOffset;
+          nLineY1 = nYMid+nTickLen;
+        } else {
+          nLineX0 = nXMid;
+          nLineY0 = nY0+nMargin+nTickOffset;
+          nLineX1 = nXMid+nTickLen;
+          nLineY1 = nY0+nMargin+nTickOffset;
+        }
+        if ((!bRedrawInc) || (gslc_ClipLine(&rClip,&nLineX0,&nLineY0,&nLineX1,&nLineY1))) {
+          gslc_DrawLine(pGui,nLineX0,nLineY0,nLineX1,nLineY1,colTick);
+        }
+      }
+    }
+
+    // Draw the track
+    // - Make the track highlight during glow
+    if (!bVert) {
+      nLineX0 = nX0+nMargin;
+      nLineY0 = nYMid;
+      nLineX1 = nX1-nMargin;
+      nLineY1 = nYMid;
+    } else {
+      nLineX0 = nXMid;
+      nLineY0 = nY0+nMargin;
+      nLineX1 = nXMid;
+      nLineY1 = nY1-nMargin;
+    }
+    if ((!bRedrawInc) || (gslc_ClipLine(&rClip,&nLineX0,&nLineY0,&nLineX1,&nLineY1))) {
+      gslc_DrawLine(pGui,nLineX0,nLineY0,nLineX1,nLineY1,
+              bGlow? GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem) : GSLC_ELEM_COL_FRAME(pGui,pElem));
+    }
+
+    // Optionally draw a trim line
+    if (bTrim) {
+      if (!bVert) {
+        nLineX0 = nX0+nMargin;
+        nLineY0 = nYMid+1;
+        nLineX1 = nX1-nMargin;
+        nLineY1 = nYMid+1;
+      } else {
+        nLineX0 = nXMid+1;
+        nLineY0 = nY0+nMargin;
+        nLineX1 = nXMid+1;
+        nLineY1 = nY1-nMargin;
+      }
+      if ((!bRedrawInc) || (gslc_ClipLine(&rClip,&nLineX0,&nLineY0,&nLineX1,&nLineY1))) {
+        gslc_DrawLine(pGui,nLineX0,nLineY0,nLineX1,nLineY1,colTrim);
+      }
+    }
+
+  } // bRedrawBack
+
   // Draw the thumb control
-  gslc_DrawFillRect(pGui,rThumb,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
-  gslc_DrawFrameRect(pGui,rThumb,(bGlow)?pElem->colElemFrameGlow:pElem->colElemFrame);
+  gslc_DrawFillRect(pGui,rThumb,(bGlow)?GSLC_ELEM_COL_FILL_GLOW(pGui,pElem):GSLC_ELEM_COL_FILL(pGui,pElem));
+  gslc_DrawFrameRect(pGui,rThumb,(bGlow)?GSLC_ELEM_COL_FRAME_GLOW(pGui,pElem):GSLC_ELEM_COL_FRAME(pGui,pElem));
   if (bTrim) {
     gslc_tsRect  rThumbTrim;
     rThumbTrim = gslc_ExpandRect(rThumb,-1,-1);
     gslc_DrawFrameRect(pGui,rThumbTrim,pSlider->colTrim);
   }
 
+  // Save the thumb region for the next incremental redraw
+  // - Saved relative to the element so that it remains valid
+  //   if the element is moved (eg. within a scroll container)
+  pSlider->rThumbLast       = rThumb;
+  pSlider->rThumbLast.x    -= nX0;
+  pSlider->rThumbLast.y    -= nY0;
+  pSlider->bThumbLastValid  = true;
 
   // Clear the redraw flag
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
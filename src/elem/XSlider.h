@@ -71,6 +71,8 @@ typedef struct {
   gslc_tsColor    colTrim;        ///< Style: color of trim
   // State
   int16_t         nPos;           ///< Current position value of the slider
+  gslc_tsRect     rThumbLast;     ///< Thumb region at last redraw (relative to element)
+  bool            bThumbLastValid;///< Thumb region from last redraw is valid?
   // Callbacks
   GSLC_CB_XSLIDER_POS pfuncXPos;  ///< Callback func ptr for position update
 } gslc_tsXSlider;
@@ -83,6 +85,7 @@ typedef struct {
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining checkbox size
 /// \param[in]  nPosMin:     Minimum position value
 /// \param[in]  nPosMax:     Maximum position value
@@ -210,6 +213,8 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
 ///
 
 
+// - Not available in the compact element layout (GSLC_FEATURE_COMPACT_ELEM)
+#if !(GSLC_FEATURE_COMPACT_ELEM)
 #if (GSLC_USE_PROGMEM)
 
 
@@ -229,6 +234,7 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
   sSlider##nElemId.colTrim = GSLC_COL_BLACK;                      \
   sSlider##nElemId.nPos = nPos_;                                  \
   sSlider##nElemId.pfuncXPos = NULL;                              \
+  sSlider##nElemId.bThumbLastValid = false;                       \
   static const gslc_tsElem sElem##nElemId PROGMEM = {             \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -248,7 +254,6 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
       0,                                                          \
       NULL,                                                       \
       (void*)(&sSlider##nElemId),                                 \
-      NULL,                                                       \
       &gslc_ElemXSliderDraw,                                      \
       &gslc_ElemXSliderTouch,                                     \
       NULL,                                                       \
@@ -275,6 +280,7 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
   sSlider##nElemId.colTrim = GSLC_COL_BLACK;                      \
   sSlider##nElemId.nPos = nPos_;                                  \
   sSlider##nElemId.pfuncXPos = NULL;                              \
+  sSlider##nElemId.bThumbLastValid = false;                       \
   static const gslc_tsElem sElem##nElemId = {                     \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
@@ -294,7 +300,6 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
       0,                                                          \
       NULL,                                                       \
       (void*)(&sSlider##nElemId),                                 \
-      NULL,                                                       \
       &gslc_ElemXSliderDraw,                                      \
       &gslc_ElemXSliderTouch,                                     \
       NULL,                                                       \
@@ -302,7 +307,8 @@ bool gslc_ElemXSliderTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int16
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
-#endif
+#endif // GSLC_USE_PROGMEM
+#endif // !GSLC_FEATURE_COMPACT_ELEM
 
 
 
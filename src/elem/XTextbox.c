@@ -74,16 +74,38 @@ extern const char GSLC_PMEM ERRSTR_PXD_NULL[];
 
 // ============================================================================
 
+// Element type dispatch table
+static const gslc_tsElemType GSLC_PMEM XTEXTBOX_TYPE = {
+  GSLC_TYPEX_TEXTBOX,&gslc_ElemXTextboxDraw,NULL,NULL,NULL
+};
+
 gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t nPage,
   gslc_tsXTextbox* pXData,gslc_tsRect rElem,int16_t nFontId,char* pBuf,
     uint16_t nBufRows,uint16_t nBufCols)
 {
-  if ((pGui == NULL) || (pXData == NULL)) {
+  if (pGui == NULL) {
     static const char GSLC_PMEM FUNCSTR[] = "ElemXTextboxCreate";
     GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return NULL;
   }
+  if (pXData == NULL) {
+    // Allocate the extended data from the extended data arena
+    pXData = (gslc_tsXTextbox*)gslc_XDataArenaAlloc(pGui,nPage,sizeof(gslc_tsXTextbox));
+  }
+  if (pXData == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXTextboxCreate";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_PXD_NULL,FUNCSTR);
+    return NULL;
+  }
+  if (pBuf == NULL) {
+    // Allocate the text buffer from the extended data arena
+    pBuf = (char*)gslc_XDataArenaAlloc(pGui,nPage,(uint32_t)nBufRows*nBufCols*sizeof(char));
+    if (pBuf == NULL) {
+      return NULL;
+    }
+  }
   gslc_tsElem     sElem;
+  gslc_tsStyle    sStyle;
   gslc_tsElemRef* pElemRef = NULL;
   sElem = gslc_ElemCreate(pGui,nElemId,nPage,GSLC_TYPEX_TEXTBOX,rElem,NULL,0,nFontId);
   sElem.nFeatures        |= GSLC_ELEM_FEA_FRAME_EN;
@@ -108,6 +130,7 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nWndRowStart    = 0;
 
   pXData->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+  pXData->nRedrawScroll = 0;
 
   // Clear the buffer
   memset(pBuf,0,nBufRows*nBufCols*sizeof(char));
@@ -125,8 +148,8 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   char          acMonoH[3] = "p$";
   char          acMonoW[2] = "w";
 
-  gslc_DrvGetTxtSize(pGui, sElem.pTxtFont, (char*)&acMonoH, sElem.eTxtFlags, &nChOffsetTmp, &nChOffsetY, &nChSzTmp, &nChSzH);
-  gslc_DrvGetTxtSize(pGui, sElem.pTxtFont, (char*)&acMonoW, sElem.eTxtFlags, &nChOffsetX, &nChOffsetTmp, &nChSzW, &nChSzTmp);
+  gslc_DrvGetTxtSize(pGui, GSLC_ELEM_TXT_FONT(pGui,&sElem), (char*)&acMonoH, sElem.eTxtFlags, &nChOffsetTmp, &nChOffsetY, &nChSzTmp, &nChSzH);
+  gslc_DrvGetTxtSize(pGui, GSLC_ELEM_TXT_FONT(pGui,&sElem), (char*)&acMonoW, sElem.eTxtFlags, &nChOffsetX, &nChOffsetTmp, &nChSzW, &nChSzTmp);
 
   pXData->nWndCols = (rElem.w - (2*pXData->nMarginX)) / nChSzW;
   pXData->nWndRows = (rElem.h - (2*pXData->nMarginY)) / nChSzH;
@@ -152,13 +175,16 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
 
   sElem.pXData            = (void*)(pXData);
 
-  // Specify the custom drawing callback
-  sElem.pfuncXDraw        = &gslc_ElemXTextboxDraw;
-  sElem.pfuncXTouch       = NULL;
-  sElem.colElemFill       = GSLC_COL_BLACK;
-  sElem.colElemFillGlow   = GSLC_COL_BLACK;
-  sElem.colElemFrame      = GSLC_COL_GRAY;
-  sElem.colElemFrameGlow  = GSLC_COL_WHITE;
+  // Use the callbacks of the element type (draw, touch, tick)
+  if (!gslc_ElemTypeRegister(pGui,&XTEXTBOX_TYPE)) {
+    return NULL;
+  }
+  gslc_ElemStyleGet(pGui,&sElem,&sStyle);
+  sStyle.colFill          = GSLC_COL_BLACK;
+  sStyle.colFillGlow      = GSLC_COL_BLACK;
+  sStyle.colFrame         = GSLC_COL_GRAY;
+  sStyle.colFrameGlow     = GSLC_COL_WHITE;
+  gslc_ElemStyleSet(pGui,&sElem,&sStyle);
   if (nPage != GSLC_PAGE_NONE) {
     pElemRef = gslc_ElemAdd(pGui,nPage,&sElem,GSLC_ELEMREF_DEFAULT);
     return pElemRef;
@@ -199,6 +225,7 @@ void gslc_ElemXTextboxReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // Set the redraw flag
   // - Only need incremental redraw
   pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL; // All-row update
+  pBox->nRedrawScroll = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
 }
 
@@ -226,8 +253,18 @@ void gslc_ElemXTextboxLineWrAdv(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   if (pBox->nBufPosY == pBox->nWndRowStart) {
     // Advance the window (with wrap if needed)
     pBox->nWndRowStart = (pBox->nWndRowStart + 1) % pBox->nBufRows;
-    // Ensure all rows get redrawn
-    pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+    // The visible rows all shift up by one. Rather than redrawing
+    // every row, request that the existing text area be scrolled
+    // (copied) upwards so that only the newly exposed row needs
+    // to be rendered. The draw routine will fall back to an
+    // all-row redraw if the driver can't copy screen regions.
+    if (pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL) {
+      pBox->nRedrawScroll++;
+      if (pBox->nRedrawScroll >= pBox->nWndRows) {
+        // Entire window has scrolled, so just redraw all rows
+        pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+      }
+    }
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -266,6 +303,36 @@ void gslc_ElemXTextboxScrollSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_
   }
 }
 
+// Mark the current buffer write row as requiring redraw
+// - If a different row is already pending then the redraw
+//   is promoted to include all rows
+void gslc_ElemXTextboxRowRedrawSet(gslc_tsXTextbox* pBox)
+{
+  // Mark this specific row as needing redraw
+  if ((pBox->nRedrawScroll > 0) && (pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL)) {
+    // A scroll is pending and the current write row was exposed
+    // by it, so it will be redrawn along with the exposed rows
+  }
+  else if (pBox->nRedrawRow == XTEXTBOX_REDRAW_NONE) {
+    // No redraw was pending, so mark single row pending
+    pBox->nRedrawRow = pBox->nBufPosY;
+  }
+  else if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
+    // All-row redraw was pending, so no change
+  }
+  else {
+    // Single row redraw was pending
+    if (pBox->nRedrawRow != pBox->nBufPosY) {
+      // But the pending row differs from the current row,
+      // so promote redraw to all lines
+      pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+    }
+    else {
+      // Pending row is the same, so no change
+    }
+  }
+}
+
 // Write a character to the buffer
 // - Advance the write ptr, wrap if needed
 // - If encroach upon buffer read ptr, then drop the oldest line from the buffer
@@ -303,25 +370,7 @@ void gslc_ElemXTextboxBufAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned
     // Don't update redraw on non-printing characters
   } else {
 
-    // Mark this specific row as needing redraw
-    if (pBox->nRedrawRow == XTEXTBOX_REDRAW_NONE) {
-      // No redraw was pending, so mark single row pending
-      pBox->nRedrawRow = pBox->nBufPosY;
-    }
-    else if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
-      // All-row redraw was pending, so no change
-    }
-    else {
-      // Single row redraw was pending
-      if (pBox->nRedrawRow != pBox->nBufPosY) {
-        // But the pending row differs from the current row,
-        // so promote redraw to all lines
-        pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
-      }
-      else {
-        // Pending row is the same, so no change
-      }
-    }
+    gslc_ElemXTextboxRowRedrawSet(pBox);
   } // chNew
 
   // Optionally advance the pointer
@@ -383,59 +432,81 @@ void gslc_ElemXTextboxWrapSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bWr
 
 void gslc_ElemXTextboxAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pTxt)
 {
+  if (pElemRef == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemXTextboxAdd";
+    GSLC_DEBUG_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
   gslc_tsXTextbox*  pBox = NULL;
   gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  //pBox = (gslc_tsXTextbox*)(pElem->pXData);
-
-  // Warn the user about mode compatibility
-#if (GSLC_FEATURE_XTEXTBOX_EMBED)
-  static bool bWarned = false;  // Warn only once
-  bool bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
-  if ((!bWarned) && (bEncUtf8)) {
-    // Continue to render the text, but issue warning to the user
-    GSLC_DEBUG_PRINT("WARNING: ElemXTextboxAdd(%s) UTF-8 encoding not supported in GSLC_FEATURE_XTEXTBOX_EMBED=1 mode\n","");
-    bWarned = true;
+  pBox = (gslc_tsXTextbox*)(pElem->pXData);
+  if (pBox == NULL) {
+    GSLC_DEBUG_PRINT("ERROR: ElemXTextboxAdd(%s) pXData is NULL\n","");
+    return;
+  }
+  if (pTxt == NULL) {
+    return;
   }
-#else
-  // Hide warnings about unused variables
-  (void)pBox;
-  (void)pElem;
-#endif
 
   // Add null-terminated string to the bottom of the buffer
-  // If the string exceeds the buffer length then it will wrap
-  // back to the beginning.
+  // - The text is scanned for newlines and row boundaries so that
+  //   each row segment can be copied into the buffer in one step
+  //   and the redraw state only needs to be updated once per row
+  // - Line wrap is deferred until more text actually needs to be
+  //   placed beyond the end of the current row
+  // - The last column of each row is reserved for the terminator
   // TODO: Ensure that buffer wrap doesn't encroach upon visible region!
-  // TODO: Assert (pBox)
-  bool            bDone = false;
-  uint16_t        nTxtPos = 0;
-  unsigned char   chNext;
-
-  if (pTxt == NULL) { bDone = true; }
-  while (!bDone) {
-    chNext = pTxt[nTxtPos];
-    nTxtPos++;
-    if (chNext == 0) {
-      // Reached terminator character
-      // Add terminator to buffer but don't advance write pointer
-      // since we want next write to overwrite this
-      gslc_ElemXTextboxBufAdd(pGui,pElemRef,0,false);
+  bool            bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  const char*     pTxtCur = pTxt;
+  uint16_t        nRowLast = pBox->nBufCols - 1;
+  uint16_t        nRowAvail;
+  uint16_t        nSegLen;
+  char            chNext;
+
+  while (true) {
+    // Determine the length of the segment that fits in the current row
+    nRowAvail = (pBox->nBufPosX < nRowLast)? (nRowLast - pBox->nBufPosX) : 0;
+    nSegLen = 0;
+    while ((nSegLen < nRowAvail) && (pTxtCur[nSegLen] != 0) && (pTxtCur[nSegLen] != '\n')) {
+      nSegLen++;
+    }
+    // Avoid splitting a UTF-8 multi-byte sequence across rows
+    if ((bEncUtf8) && (pBox->nBufPosX > 0)) {
+      while ((nSegLen > 0) && (((unsigned char)pTxtCur[nSegLen] & 0xC0) == 0x80)) {
+        nSegLen--;
+      }
+    }
 
-      bDone = true;
-      continue;
+    // Copy the segment into the buffer
+    if (nSegLen > 0) {
+      memcpy(&(pBox->pBuf[pBox->nBufPosY * pBox->nBufCols + pBox->nBufPosX]),pTxtCur,nSegLen);
+      pBox->nBufPosX += nSegLen;
+      pTxtCur += nSegLen;
+      gslc_ElemXTextboxRowRedrawSet(pBox);
     }
 
-    // FIXME: It is possible that the following check may no longer be
-    // appropriate when using UTF-8 encoding mode.
-    if (chNext == '\n') {
-      // Terminate the line
-      gslc_ElemXTextboxBufAdd(pGui,pElemRef,0,false);
+    // Terminate the current row
+    // - We don't advance the write pointer since we want the
+    //   next write to overwrite this
+    pBox->pBuf[pBox->nBufPosY * pBox->nBufCols + pBox->nBufPosX] = 0;
+
+    chNext = *pTxtCur;
+    if (chNext == 0) {
+      // Reached end of string
+      break;
+    } else if (chNext == '\n') {
       // Advance the writer by one line
+      pTxtCur++;
+      gslc_ElemXTextboxLineWrAdv(pGui,pElemRef);
+    } else if ((pBox->bWrapEn) && (nRowLast > 0)) {
+      // Row is full and more text follows, so perform line wrap
       gslc_ElemXTextboxLineWrAdv(pGui,pElemRef);
     } else {
-      // TODO: Check to see if we are in mask/truncate state
-      // Note that this routine also handles line wrap
-      gslc_ElemXTextboxBufAdd(pGui,pElemRef,chNext,true);
+      // Row is full and wrap is disabled, so discard the
+      // remainder of the line
+      while ((*pTxtCur != 0) && (*pTxtCur != '\n')) {
+        pTxtCur++;
+      }
     }
   }
 
@@ -470,7 +541,36 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,GSLC_ELEM_COL_FRAME(pGui,pElem));
+    }
+  }
+
+  // Scroll the existing text area upwards if requested
+  // - The rows that remain visible are moved with a display copy
+  //   and only the newly exposed rows at the bottom are cleared
+  //   and rendered
+  // - If the driver doesn't support copying display regions then
+  //   we revert to redrawing all rows
+  uint8_t nScrollRows = 0;
+  if ((eRedraw == GSLC_REDRAW_INC) && (pBox->nRedrawScroll > 0) && (pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL)) {
+    uint8_t     nWndMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+    gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
+    gslc_tsRect rCopy;
+    int16_t     nRowsY = pElem->rElem.y + pBox->nMarginY;
+    nScrollRows = pBox->nRedrawScroll;
+    rCopy.x = rInner.x;
+    rCopy.y = nRowsY + nScrollRows * pBox->nChSizeY;
+    rCopy.w = rInner.w;
+    rCopy.h = (nScrollRows < nWndMaxRow)? (nWndMaxRow - nScrollRows) * pBox->nChSizeY : 0;
+    if ((nScrollRows < nWndMaxRow) && (gslc_DrawCopyRect(pGui, rCopy, rCopy.x, nRowsY))) {
+      // Clear the exposed rows
+      rCopy.y = nRowsY + (nWndMaxRow - nScrollRows) * pBox->nChSizeY;
+      rCopy.h = nScrollRows * pBox->nChSizeY;
+      colBg = (bGlow) ? GSLC_ELEM_COL_FILL_GLOW(pGui,pElem) : GSLC_ELEM_COL_FILL(pGui,pElem);
+      gslc_DrawFillRect(pGui, rCopy, colBg);
+    } else {
+      nScrollRows = 0;
+      pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
     }
   }
 
@@ -478,7 +578,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // - Only do this if we need to redraw all rows
   if (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL) {
     gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
-    colBg = (bGlow) ? pElem->colElemFillGlow : pElem->colElemFill;
+    colBg = (bGlow) ? GSLC_ELEM_COL_FILL_GLOW(pGui,pElem) : GSLC_ELEM_COL_FILL(pGui,pElem);
     gslc_DrawFillRect(pGui, rInner, colBg);
   }
 
@@ -495,7 +595,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   //bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
 
   // Initialize color state
-  colTxt = pElem->colElemText;
+  colTxt = GSLC_ELEM_COL_TEXT(pGui,pElem);
 
   // Calculate the starting row for the window
   uint16_t nWndRowStartScr = pBox->nWndRowStart;
@@ -529,7 +629,13 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     // row has been marked as requiring redraw, then skip
     // all other rows
     if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
+      if (nScrollRows > 0) {
+        // Scrolled redraw: only draw the exposed rows at the bottom
+        // and any other single row that was pending
+        if ((nOutRow < nMaxRow - nScrollRows) && (pBox->nRedrawRow != nRowCur)) {
+          bRedrawLine = false;
+        }
+      } else if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
         // Single-row redraw, but we are not on that row, so skip
         bRedrawLine = false;
       }
@@ -546,7 +652,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
       nTxtPixX = pElem->rElem.x + pBox->nMarginX + 0 * pBox->nChSizeX;
       nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
-      gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, pElem->pTxtFont, (char*)&(pBox->pBuf[nBufPos]), pElem->eTxtFlags, colTxt, colBg);
+      gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, GSLC_ELEM_TXT_FONT(pGui,pElem), (char*)&(pBox->pBuf[nBufPos]), pElem->eTxtFlags, colTxt, colBg);
     }
 
     nCurY++;
@@ -556,23 +662,39 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Embedded color mode support
   // - This mode supports inline changing of text color
-  // - However, it does not support UTF-8 character encoding
-  // - It is also slower since rendering is per-character
+  // - Each row is parsed into runs of constant color and each run
+  //   is rendered with a single DrvDrawTxt() call
+  // - The starting position of a run is derived from the cached
+  //   character advance (nChSizeX) and the number of glyphs that
+  //   precede it in the row. In UTF-8 mode, a multi-byte sequence
+  //   counts as a single glyph.
 
   enum              {TBOX_NORM, TBOX_COL_SET};
   int16_t           eTBoxState = TBOX_NORM;
   uint16_t          nTBoxStateCnt = 0;
 
+  bool              bEncUtf8;
   unsigned char     chNext;
+  char              chSaved;
   uint8_t           nCurX = 0;
   uint8_t           nCurY = 0;
+  uint8_t           nUtf8Cont = 0;    // Remaining UTF-8 continuation bytes
+
+  // Current run state
+  bool              bRunActive = false;
+  bool              bRunEnd = false;
+  uint16_t          nRunPos = 0;      // Buffer position of start of run
+  uint8_t           nRunX = 0;        // Glyph column of start of run
+  gslc_tsColor      colRun;
+
+  uint8_t  nOutRow = 0;
+  uint16_t nOutCol = 0;
+  uint8_t  nMaxRow = 0;
+  bool     bRowDone = false;
+
+  bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  colRun = colTxt;
 
-  uint8_t nOutRow = 0;
-  uint8_t nOutCol = 0;
-  uint8_t nMaxCol = 0;
-  uint8_t nMaxRow = 0;
-  bool    bRowDone = false;
-  nMaxCol = (pBox->nBufCols < pBox->nWndCols)? pBox->nBufCols : pBox->nWndCols;
   nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
@@ -587,19 +709,24 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     // row has been marked as requiring redraw, then skip
     // all other rows
     if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
+      if (nScrollRows > 0) {
+        // Scrolled redraw: only draw the exposed rows at the bottom
+        // and any other single row that was pending
+        if ((nOutRow < nMaxRow - nScrollRows) && (pBox->nRedrawRow != nRowCur)) {
+          bRedrawLine = false;
+        }
+      } else if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
         // Single-row redraw, but we are not on that row, so skip
         bRedrawLine = false;
       }
     }
 
-    bRowDone = false;
-    nCurX = 0;
-    for (nOutCol=0;(!bRowDone)&&(bRedrawLine)&&(nOutCol<nMaxCol);nOutCol++) {
-
-
-
-
+    bRowDone    = false;
+    bRunActive  = false;
+    nUtf8Cont   = 0;
+    nCurX       = 0;
+    nTxtPixY    = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
+    for (nOutCol=0;(!bRowDone)&&(bRedrawLine)&&(nOutCol<pBox->nBufCols);nOutCol++) {
 
       // NOTE: At the start of buffer fill where we have
       // only written a couple rows, we don't stop reading
@@ -609,37 +736,13 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
       nBufPos = nRowCur * pBox->nBufCols + nOutCol;
       chNext = pBox->pBuf[nBufPos];
+      // The last column of each row is reserved for the terminator
+      if (nOutCol == pBox->nBufCols-1) {
+        chNext = 0;
+      }
 
-      if (eTBoxState == TBOX_NORM) {
-        if (chNext == 0) {
-          // Reached early terminator
-          bRowDone = true;
-          continue;
-        } else if (chNext == GSLC_XTEXTBOX_CODE_COL_SET) {
-          // Set color (enter FSM)
-          eTBoxState = TBOX_COL_SET;
-          nTBoxStateCnt = 0;
-        } else if (chNext == GSLC_XTEXTBOX_CODE_COL_RESET) {
-          // Reset color
-          colTxt = pElem->colElemText;
-        } else {
-
-          // Render the character
-          // TODO: Optimize by coalescing all characters in row before calling DrvDrawTxt
-          //       - Note that this would make it harder to change aspects (such as color)
-          //         in mid-line.
-          char  acChToDraw[2] = "";
-          acChToDraw[0] = chNext;
-          acChToDraw[1] = 0;
-          nTxtPixX = pElem->rElem.x + pBox->nMarginX + nCurX * pBox->nChSizeX;
-          nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
-          gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,pElem->pTxtFont,(char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
-
-          nCurX++;
-
-        }
-
-      } else if (eTBoxState == TBOX_COL_SET) {
+      if (eTBoxState == TBOX_COL_SET) {
+        // Consume the color code parameters
         nTBoxStateCnt++;
         if      (nTBoxStateCnt == 1) { colTxt.r = chNext; }
         else if (nTBoxStateCnt == 2) { colTxt.g = chNext; }
@@ -647,7 +750,58 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
           colTxt.b = chNext;
           eTBoxState = TBOX_NORM;
         }
-      } // eTBoxState
+        continue;
+      }
+
+      bRunEnd = false;
+      if ((nUtf8Cont > 0) && ((chNext & 0xC0) == 0x80)) {
+        // Continuation of a multi-byte UTF-8 glyph
+        // - Note that the embedded codes overlap the UTF-8 continuation
+        //   byte range, so they are only recognized at a glyph boundary
+        nUtf8Cont--;
+        continue;
+      }
+      nUtf8Cont = 0;
+
+      if ((chNext == 0) || (nCurX >= pBox->nWndCols)) {
+        // Reached terminator or right edge of window
+        bRunEnd = true;
+        bRowDone = true;
+      } else if (chNext == GSLC_XTEXTBOX_CODE_COL_SET) {
+        // Set color (enter FSM)
+        bRunEnd = true;
+        eTBoxState = TBOX_COL_SET;
+        nTBoxStateCnt = 0;
+      } else if (chNext == GSLC_XTEXTBOX_CODE_COL_RESET) {
+        // Reset color
+        bRunEnd = true;
+        colTxt = GSLC_ELEM_COL_TEXT(pGui,pElem);
+      } else {
+        // Printable glyph: extend the current run or start a new one
+        if (!bRunActive) {
+          bRunActive = true;
+          nRunPos    = nBufPos;
+          nRunX      = nCurX;
+          colRun     = colTxt;
+        }
+        if ((bEncUtf8) && (chNext >= 0xC0)) {
+          // Lead byte of a multi-byte UTF-8 glyph
+          nUtf8Cont = (chNext >= 0xF0)? 3 : (chNext >= 0xE0)? 2 : 1;
+        }
+        nCurX++;
+      }
+
+      if ((bRunEnd) && (bRunActive)) {
+        // Render the run
+        // - Temporarily terminate the run in the buffer so that
+        //   it can be passed directly to the driver without copying
+        chSaved = pBox->pBuf[nBufPos];
+        pBox->pBuf[nBufPos] = 0;
+        nTxtPixX = pElem->rElem.x + pBox->nMarginX + nRunX * pBox->nChSizeX;
+        gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,GSLC_ELEM_TXT_FONT(pGui,pElem),(char*)&(pBox->pBuf[nRunPos]),pElem->eTxtFlags,colRun,colBg);
+        pBox->pBuf[nBufPos] = chSaved;
+        bRunActive = false;
+      }
 
     } // nOutCol
     nCurY++;
@@ -657,6 +811,7 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Clear the redraw flag
   pBox->nRedrawRow = XTEXTBOX_REDRAW_NONE;
+  pBox->nRedrawScroll = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
    
   // Mark page as needing flip
@@ -87,6 +87,7 @@ typedef struct {
   uint8_t                     nWndRowStart; ///< First row of current window
   // Redraw
   int16_t                     nRedrawRow;   ///< Specific row to update in redraw (if not -1)
+  uint8_t                     nRedrawScroll;///< Number of rows to scroll up (by copy) before redraw
 
 } gslc_tsXTextbox;
 
@@ -100,15 +101,19 @@ typedef struct {
 ///   display size (defined by rElem), then a scrollbar will be shown.
 /// - Support for changing color within a row can be enabled with GSLC_FEATURE_XTEXTBOX_EMBED 1
 /// - Note that each color change command will consume 4 of the available "column" bytes.
+/// - In embedded color mode, each row is rendered as runs of constant color and
+///   text may use UTF-8 encoding (a multi-byte sequence occupies one display column)
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
 /// \param[in]  nPage:       Page ID to attach element to
 /// \param[in]  pXData:      Ptr to extended element data structure
+///                          (or NULL to allocate from the extended data arena)
 /// \param[in]  rElem:       Rectangle coordinates defining textbox size
 /// \param[in]  nFontId:     Font ID to use for text area
 /// \param[in]  pBuf:        Ptr to text buffer (already allocated)
-///                          with size (nBufRows*nBufCols) chars
+///                          with size (nBufRows*nBufCols) chars, or NULL
+///                          to allocate from the extended data arena
 /// \param[in]  nBufRows:    Number of rows in buffer
 /// \param[in]  nBufCols:    Number of columns in buffer (incl special codes)
 ///
@@ -146,7 +151,10 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 /// - If it includes a newline then the buffer will
 ///   advance to the next row
 /// - If wrap has been enabled, then a newline will
-///   be forced
+///   be forced when the text exceeds the row length
+/// - The text is copied into the buffer a row segment at
+///   a time, so large blocks of text can be added in a
+///   single call and result in a single redraw
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference